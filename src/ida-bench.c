@@ -0,0 +1,316 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+// Standalone benchmark of the coding functions. It does not depend on
+// glusterfs. Each measurement is written as a single tab separated line:
+//
+//     <op> <backend> <nodes> <redundancy> <systematic> <size> <rows> <GB/s>
+//
+// where <op> is 'split' (all fragments of the buffer computed at once) or
+// 'merge' (original data recovered from the fragments listed in <rows>).
+// <size> is the amount of user data processed on each call and throughput is
+// always computed over user data.
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "ida-rabin.h"
+
+#define IDA_BENCH_GROUP (16 * IDA_RABIN_BITS)
+
+#define IDA_BENCH_GEOMETRIES "3:1,4:1,6:2,8:2,12:4"
+#define IDA_BENCH_SIZES      "65536,1048576"
+
+typedef struct
+{
+    const char * backend;
+    const char * geometries;
+    const char * sizes;
+    uint64_t     time;
+    uint64_t     combinations;
+    bool         systematic;
+} ida_bench_t;
+
+static uint64_t ida_bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void ida_bench_report(const char * op, ida_rabin_t * rabin,
+                             uint32_t size, const char * rows,
+                             uint64_t count, uint64_t elapsed)
+{
+    printf("%s\t%s\t%u\t%u\t%u\t%u\t%s\t%.3f\n", op, ida_rabin_backend_name(),
+           rabin->rows, rabin->rows - rabin->columns, rabin->systematic, size,
+           rows, (double)size * count / elapsed);
+}
+
+// Repeats 'op' doubling the number of iterations until it takes more than
+// the configured time.
+#define IDA_BENCH_RUN(_bench, _count, _elapsed, _op) \
+    do \
+    { \
+        uint64_t __i, __start; \
+        _count = 1; \
+        do \
+        { \
+            __start = ida_bench_now(); \
+            for (__i = 0; __i < _count; __i++) \
+            { \
+                _op; \
+            } \
+            _elapsed = ida_bench_now() - __start; \
+            _count <<= 1; \
+        } while (_elapsed < (_bench)->time); \
+        _count >>= 1; \
+    } while (0)
+
+static int32_t ida_bench_geometry(ida_bench_t * bench, uint32_t nodes,
+                                  uint32_t redundancy, uint32_t size)
+{
+    ida_rabin_t rabin;
+    uint8_t * frags[IDA_RABIN_MAX_ROWS], * ptrs[IDA_RABIN_MAX_ROWS];
+    uint8_t * in, * out;
+    uint32_t rows[IDA_RABIN_MAX_ROWS];
+    char text[IDA_RABIN_MAX_ROWS * 3 + 1];
+    uint64_t mask, last, bit, low, count, elapsed, done;
+    uint32_t i, j, columns, frag_size;
+    int32_t error;
+
+    columns = nodes - redundancy;
+    error = ida_rabin_setup(&rabin, nodes, columns, bench->systematic);
+    if (error != 0)
+    {
+        fprintf(stderr, "Invalid geometry %u:%u\n", nodes, redundancy);
+
+        return error;
+    }
+
+    size -= size % (IDA_BENCH_GROUP * columns);
+    if (size == 0)
+    {
+        return 0;
+    }
+    frag_size = size / columns;
+
+    memset(frags, 0, sizeof(frags));
+    error = ENOMEM;
+    in = aligned_alloc(64, size);
+    out = aligned_alloc(64, size);
+    for (i = 0; i < nodes; i++)
+    {
+        frags[i] = aligned_alloc(64, frag_size);
+        if (frags[i] == NULL)
+        {
+            goto failed;
+        }
+        rows[i] = i;
+    }
+    if ((in == NULL) || (out == NULL))
+    {
+        goto failed;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        in[i] = random();
+    }
+
+    IDA_BENCH_RUN(bench, count, elapsed,
+                  ida_rabin_split_multi(&rabin, size, nodes, rows, in,
+                                        frags));
+    ida_bench_report("split", &rabin, size, "all", count, elapsed);
+
+    // All combinations of 'columns' fragments are enumerated in lexicographic
+    // order of their bitmask.
+    error = 0;
+    done = 0;
+    mask = (1ULL << columns) - 1ULL;
+    last = mask << (nodes - columns);
+    while ((bench->combinations == 0) || (done < bench->combinations))
+    {
+        text[0] = 0;
+        for (i = 0, j = 0; i < nodes; i++)
+        {
+            if ((mask & (1ULL << i)) != 0)
+            {
+                rows[j] = i;
+                ptrs[j] = frags[i];
+                sprintf(text + strlen(text), "%s%u", (j == 0) ? "" : ",", i);
+                j++;
+            }
+        }
+
+        memset(out, 0, size);
+        ida_rabin_merge(&rabin, frag_size, rows, ptrs, out);
+        if (memcmp(in, out, size) != 0)
+        {
+            fprintf(stderr, "Data mismatch on %u:%u using fragments %s\n",
+                    nodes, redundancy, text);
+            error = EIO;
+        }
+
+        IDA_BENCH_RUN(bench, count, elapsed,
+                      ida_rabin_merge(&rabin, frag_size, rows, ptrs, out));
+        ida_bench_report("merge", &rabin, size, text, count, elapsed);
+
+        done++;
+        if (mask == last)
+        {
+            break;
+        }
+
+        bit = mask & -mask;
+        low = mask + bit;
+        mask = (((low ^ mask) >> 2) / bit) | low;
+    }
+
+failed:
+    for (i = 0; i < nodes; i++)
+    {
+        free(frags[i]);
+    }
+    free(out);
+    free(in);
+
+    if (error == ENOMEM)
+    {
+        fprintf(stderr, "Not enough memory\n");
+    }
+
+    return error;
+}
+
+static void ida_bench_usage(const char * name)
+{
+    fprintf(stderr,
+            "Usage: %s [-b <backend>] [-g <nodes>:<redundancy>[,...]]\n"
+            "       [-s <size>[,...]] [-t <msec>] [-c <count>] [-y]\n"
+            "\n"
+            "  -b  Coding backend to use (sse2, avx2, avx512). Defaults to "
+            "the fastest one.\n"
+            "  -g  Geometries to test. Defaults to " IDA_BENCH_GEOMETRIES
+            ".\n"
+            "  -s  Buffer sizes to test. Defaults to " IDA_BENCH_SIZES ".\n"
+            "  -t  Minimum duration of each measurement. Defaults to 20.\n"
+            "  -c  Maximum number of fragment combinations tested for each "
+            "geometry.\n"
+            "      Defaults to 0 (all).\n"
+            "  -y  Use the systematic version of the dispersal matrix.\n",
+            name);
+}
+
+int main(int argc, char * argv[])
+{
+    ida_bench_t bench;
+    char * geometry, * size, * ptr1, * ptr2;
+    uint32_t nodes, redundancy;
+    int32_t opt, error;
+
+    bench.backend = NULL;
+    bench.geometries = IDA_BENCH_GEOMETRIES;
+    bench.sizes = IDA_BENCH_SIZES;
+    bench.time = 20;
+    bench.combinations = 0;
+    bench.systematic = false;
+
+    while ((opt = getopt(argc, argv, "b:g:s:t:c:yh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b':
+                bench.backend = optarg;
+                break;
+            case 'g':
+                bench.geometries = optarg;
+                break;
+            case 's':
+                bench.sizes = optarg;
+                break;
+            case 't':
+                bench.time = strtoull(optarg, NULL, 0);
+                break;
+            case 'c':
+                bench.combinations = strtoull(optarg, NULL, 0);
+                break;
+            case 'y':
+                bench.systematic = true;
+                break;
+            default:
+                ida_bench_usage(argv[0]);
+                return 1;
+        }
+    }
+    bench.time *= 1000000ULL;
+
+    ida_rabin_initialize();
+    if (bench.backend != NULL)
+    {
+        error = ida_rabin_backend_select(bench.backend);
+        if (error != 0)
+        {
+            fprintf(stderr, "Unable to use backend '%s': %s\n", bench.backend,
+                    strerror(error));
+
+            return 1;
+        }
+    }
+
+    srandom(1);
+
+    printf("# op\tbackend\tnodes\tredundancy\tsystematic\tsize\trows\tGB/s\n");
+
+    error = 0;
+    geometry = strdup(bench.geometries);
+    for (ptr1 = strtok_r(geometry, ",", &ptr2); ptr1 != NULL;
+         ptr1 = strtok_r(NULL, ",", &ptr2))
+    {
+        if (sscanf(ptr1, "%u:%u", &nodes, &redundancy) != 2)
+        {
+            fprintf(stderr, "Invalid geometry '%s'\n", ptr1);
+            error = EINVAL;
+
+            break;
+        }
+
+        size = strdup(bench.sizes);
+        for (ptr1 = strtok(size, ","); ptr1 != NULL; ptr1 = strtok(NULL, ","))
+        {
+            if (ida_bench_geometry(&bench, nodes, redundancy,
+                                   strtoul(ptr1, NULL, 0)) != 0)
+            {
+                error = EIO;
+            }
+        }
+        free(size);
+    }
+    free(geometry);
+
+    return (error == 0) ? 0 : 1;
+}
@@ -0,0 +1,475 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include "ida-mem-types.h"
+#include "ida-cache.h"
+
+// Each entry holds the decoded contents of a single block of a file. Entries
+// are found through a hash table indexed by the gfid of the file and the
+// offset of the block.
+struct _ida_cache_entry
+{
+    struct list_head hash;
+    struct list_head lru;
+    uuid_t           gfid;
+    off_t            offset;
+    uint64_t         seq;
+    uint32_t         users;
+    bool             valid;
+    uint8_t          data[];
+};
+
+// While a barrier exists for a file, no block of it can be claimed. It's used
+// by operations that modify the contents of a file without knowing them, like
+// truncate.
+struct _ida_cache_barrier
+{
+    struct list_head list;
+    uuid_t           gfid;
+    uint32_t         refs;
+};
+
+err_t ida_cache_initialize(ida_cache_t * cache, size_t block_size,
+                           uint32_t size)
+{
+    uint32_t i, buckets;
+
+    pthread_mutex_init(&cache->lock, NULL);
+    INIT_LIST_HEAD(&cache->lru);
+    INIT_LIST_HEAD(&cache->barriers);
+    cache->table = NULL;
+    cache->block_size = block_size;
+    cache->size = 0;
+    cache->count = 0;
+    cache->mask = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    buckets = 1;
+    while (buckets < size)
+    {
+        buckets <<= 1;
+    }
+
+    SYS_CALLOC0(
+        &cache->table, buckets, ida_mt_ida_cache_t,
+        E(),
+        RETERR()
+    );
+    for (i = 0; i < buckets; i++)
+    {
+        INIT_LIST_HEAD(&cache->table[i]);
+    }
+    cache->mask = buckets - 1;
+    cache->size = size;
+
+    return 0;
+}
+
+void ida_cache_terminate(ida_cache_t * cache)
+{
+    ida_cache_entry_t * entry, * tmp;
+    ida_cache_barrier_t * barrier, * next;
+
+    // Nothing to do if the cache has never been initialized.
+    if (cache->lru.next == NULL)
+    {
+        return;
+    }
+
+    list_for_each_entry_safe(entry, tmp, &cache->lru, lru)
+    {
+        list_del_init(&entry->lru);
+        SYS_FREE(entry);
+    }
+    list_for_each_entry_safe(barrier, next, &cache->barriers, list)
+    {
+        list_del_init(&barrier->list);
+        SYS_FREE(barrier);
+    }
+    if (cache->table != NULL)
+    {
+        SYS_FREE(cache->table);
+        cache->table = NULL;
+    }
+    cache->size = 0;
+    cache->count = 0;
+
+    pthread_mutex_destroy(&cache->lock);
+}
+
+void ida_cache_lock(ida_cache_t * cache)
+{
+    pthread_mutex_lock(&cache->lock);
+}
+
+void ida_cache_unlock(ida_cache_t * cache)
+{
+    pthread_mutex_unlock(&cache->lock);
+}
+
+static struct list_head * ida_cache_bucket(ida_cache_t * cache, uuid_t gfid,
+                                           off_t offset)
+{
+    uint64_t hash;
+
+    memcpy(&hash, gfid, sizeof(hash));
+    hash ^= (offset / cache->block_size) * 0x9E3779B97F4A7C15ULL;
+    hash *= 0x9E3779B97F4A7C15ULL;
+
+    return &cache->table[(hash >> 32) & cache->mask];
+}
+
+static ida_cache_entry_t * __ida_cache_lookup(ida_cache_t * cache,
+                                              uuid_t gfid, off_t offset)
+{
+    ida_cache_entry_t * entry;
+
+    list_for_each_entry(entry, ida_cache_bucket(cache, gfid, offset), hash)
+    {
+        if ((entry->offset == offset) &&
+            (uuid_compare(entry->gfid, gfid) == 0))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void __ida_cache_remove(ida_cache_t * cache, ida_cache_entry_t * entry)
+{
+    list_del_init(&entry->hash);
+    list_del_init(&entry->lru);
+    cache->count--;
+
+    SYS_FREE(entry);
+}
+
+// Makes the contents of an entry unusable. Entries being written are kept
+// until released, but their current claimers won't be able to validate them.
+static void __ida_cache_drop(ida_cache_t * cache, ida_cache_entry_t * entry)
+{
+    entry->seq++;
+    entry->valid = false;
+    if (entry->users == 0)
+    {
+        __ida_cache_remove(cache, entry);
+    }
+}
+
+// Evicts the least recently used entries that are not being written until
+// the cache is back to its maximum size.
+static void __ida_cache_trim(ida_cache_t * cache)
+{
+    ida_cache_entry_t * entry;
+    struct list_head * item;
+
+    item = cache->lru.prev;
+    while ((cache->count > cache->size) && (item != &cache->lru))
+    {
+        entry = list_entry(item, ida_cache_entry_t, lru);
+        item = item->prev;
+        if (entry->users == 0)
+        {
+            __ida_cache_remove(cache, entry);
+        }
+    }
+}
+
+static void __ida_cache_invalidate_inode(ida_cache_t * cache, uuid_t gfid)
+{
+    ida_cache_entry_t * entry, * tmp;
+
+    list_for_each_entry_safe(entry, tmp, &cache->lru, lru)
+    {
+        if (uuid_compare(entry->gfid, gfid) == 0)
+        {
+            __ida_cache_drop(cache, entry);
+        }
+    }
+}
+
+static bool __ida_cache_blocked(ida_cache_t * cache, uuid_t gfid)
+{
+    ida_cache_barrier_t * barrier;
+
+    list_for_each_entry(barrier, &cache->barriers, list)
+    {
+        if (uuid_compare(barrier->gfid, gfid) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Claims the block at 'offset' of a file. If its contents are known, they
+// are copied to 'data' and true is returned. The cache must be locked and the
+// claim must be done in the same order in which the writes are sent to the
+// bricks, otherwise a write could see stale data.
+bool __ida_cache_claim(ida_cache_t * cache, uuid_t gfid, off_t offset,
+                       uint8_t * data, ida_cache_claim_t * claim)
+{
+    ida_cache_entry_t * entry;
+    bool found;
+
+    claim->entry = NULL;
+    if (cache->size == 0)
+    {
+        return false;
+    }
+
+    entry = __ida_cache_lookup(cache, gfid, offset);
+    if (__ida_cache_blocked(cache, gfid))
+    {
+        if (entry != NULL)
+        {
+            __ida_cache_drop(cache, entry);
+        }
+
+        return false;
+    }
+
+    if (entry == NULL)
+    {
+        SYS_ALLOC(
+            &entry, sizeof(ida_cache_entry_t) + cache->block_size,
+            ida_mt_ida_cache_t,
+            E(),
+            RETVAL(false)
+        );
+        uuid_copy(entry->gfid, gfid);
+        entry->offset = offset;
+        entry->seq = 0;
+        entry->users = 0;
+        entry->valid = false;
+        list_add(&entry->hash, ida_cache_bucket(cache, gfid, offset));
+        list_add(&entry->lru, &cache->lru);
+        cache->count++;
+    }
+    else
+    {
+        list_del(&entry->lru);
+        list_add(&entry->lru, &cache->lru);
+    }
+
+    // Contents of an entry claimed by a previous write are not usable until
+    // that write finishes.
+    found = entry->valid && (entry->users == 0);
+    if (found)
+    {
+        memcpy(data, entry->data, cache->block_size);
+    }
+
+    entry->users++;
+    entry->seq++;
+    claim->entry = entry;
+    claim->seq = entry->seq;
+
+    __ida_cache_trim(cache);
+
+    return found;
+}
+
+// Drops all blocks of a file fully or partially contained in the given range.
+// The cache must be locked.
+void __ida_cache_invalidate(ida_cache_t * cache, uuid_t gfid, off_t offset,
+                            size_t size)
+{
+    ida_cache_entry_t * entry, * tmp;
+    off_t end;
+
+    if ((cache->size == 0) || (size == 0))
+    {
+        return;
+    }
+
+    offset -= offset % cache->block_size;
+    end = offset + size;
+
+    // Big ranges are handled by looking at all cached blocks instead of
+    // looking for each block of the range.
+    if (size / cache->block_size > cache->count)
+    {
+        list_for_each_entry_safe(entry, tmp, &cache->lru, lru)
+        {
+            if ((entry->offset >= offset) && (entry->offset < end) &&
+                (uuid_compare(entry->gfid, gfid) == 0))
+            {
+                __ida_cache_drop(cache, entry);
+            }
+        }
+
+        return;
+    }
+
+    while (offset < end)
+    {
+        entry = __ida_cache_lookup(cache, gfid, offset);
+        if (entry != NULL)
+        {
+            __ida_cache_drop(cache, entry);
+        }
+        offset += cache->block_size;
+    }
+}
+
+// Saves the new contents of a claimed block. They are not used until the
+// claim is released as valid.
+void ida_cache_store(ida_cache_t * cache, ida_cache_claim_t * claim,
+                     uint8_t * data)
+{
+    if (claim->entry == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+
+    if (claim->entry->seq == claim->seq)
+    {
+        memcpy(claim->entry->data, data, cache->block_size);
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+}
+
+// Releases a claim once the write has finished. 'valid' tells if the write
+// succeeded, so that the stored contents match the ones on the bricks.
+void ida_cache_release(ida_cache_t * cache, ida_cache_claim_t * claim,
+                       bool valid)
+{
+    ida_cache_entry_t * entry;
+
+    entry = claim->entry;
+    if (entry == NULL)
+    {
+        return;
+    }
+    claim->entry = NULL;
+
+    pthread_mutex_lock(&cache->lock);
+
+    entry->users--;
+    if (entry->seq == claim->seq)
+    {
+        entry->valid = valid;
+    }
+    if (!entry->valid && (entry->users == 0))
+    {
+        __ida_cache_remove(cache, entry);
+    }
+    else
+    {
+        __ida_cache_trim(cache);
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void ida_cache_invalidate(ida_cache_t * cache, uuid_t gfid)
+{
+    if (cache->size == 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+
+    __ida_cache_invalidate_inode(cache, gfid);
+
+    pthread_mutex_unlock(&cache->lock);
+}
+
+// Prevents any block of a file from being used until ida_cache_unblock() is
+// called. Blocks claimed before or while the barrier exists can never become
+// valid.
+ida_cache_barrier_t * ida_cache_block(ida_cache_t * cache, uuid_t gfid)
+{
+    ida_cache_barrier_t * barrier;
+
+    if (cache->size == 0)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+
+    __ida_cache_invalidate_inode(cache, gfid);
+
+    list_for_each_entry(barrier, &cache->barriers, list)
+    {
+        if (uuid_compare(barrier->gfid, gfid) == 0)
+        {
+            barrier->refs++;
+
+            goto done;
+        }
+    }
+
+    SYS_MALLOC0(
+        &barrier, ida_mt_ida_cache_t,
+        E(),
+        LOG(E(), "Unable to block the stripe cache of a file."),
+        GOTO(failed)
+    );
+    uuid_copy(barrier->gfid, gfid);
+    barrier->refs = 1;
+    list_add(&barrier->list, &cache->barriers);
+
+done:
+    pthread_mutex_unlock(&cache->lock);
+
+    return barrier;
+
+failed:
+    pthread_mutex_unlock(&cache->lock);
+
+    return NULL;
+}
+
+void ida_cache_unblock(ida_cache_t * cache, ida_cache_barrier_t * barrier)
+{
+    if (barrier == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+
+    // Writes claimed while the barrier was active could have been ordered
+    // before the operation that created it.
+    __ida_cache_invalidate_inode(cache, barrier->gfid);
+
+    if (--barrier->refs == 0)
+    {
+        list_del_init(&barrier->list);
+        SYS_FREE(barrier);
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+}
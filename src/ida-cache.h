@@ -0,0 +1,79 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_CACHE_H__
+#define __IDA_CACHE_H__
+
+#include <pthread.h>
+
+#include "list.h"
+#include "xlator.h"
+
+struct _ida_cache_entry;
+typedef struct _ida_cache_entry ida_cache_entry_t;
+
+struct _ida_cache_barrier;
+typedef struct _ida_cache_barrier ida_cache_barrier_t;
+
+// A write that needs to know the contents of a partial block claims its cache
+// entry. Claimed entries are never served to other writes. Each new claim or
+// invalidation increments the sequence of the entry, so only the most recent
+// claimer is allowed to store the new contents of the block and make them
+// valid.
+typedef struct
+{
+    ida_cache_entry_t * entry;
+    uint64_t            seq;
+} ida_cache_claim_t;
+
+typedef struct
+{
+    pthread_mutex_t    lock;
+    struct list_head   lru;
+    struct list_head   barriers;
+    struct list_head * table;
+    size_t             block_size;
+    uint32_t           size;
+    uint32_t           count;
+    uint32_t           mask;
+} ida_cache_t;
+
+err_t ida_cache_initialize(ida_cache_t * cache, size_t block_size,
+                           uint32_t size);
+void ida_cache_terminate(ida_cache_t * cache);
+
+void ida_cache_lock(ida_cache_t * cache);
+void ida_cache_unlock(ida_cache_t * cache);
+
+bool __ida_cache_claim(ida_cache_t * cache, uuid_t gfid, off_t offset,
+                       uint8_t * data, ida_cache_claim_t * claim);
+void __ida_cache_invalidate(ida_cache_t * cache, uuid_t gfid, off_t offset,
+                            size_t size);
+
+void ida_cache_store(ida_cache_t * cache, ida_cache_claim_t * claim,
+                     uint8_t * data);
+void ida_cache_release(ida_cache_t * cache, ida_cache_claim_t * claim,
+                       bool valid);
+void ida_cache_invalidate(ida_cache_t * cache, uuid_t gfid);
+
+ida_cache_barrier_t * ida_cache_block(ida_cache_t * cache, uuid_t gfid);
+void ida_cache_unblock(ida_cache_t * cache, ida_cache_barrier_t * barrier);
+
+#endif /* __IDA_CACHE_H__ */
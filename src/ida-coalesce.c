@@ -0,0 +1,507 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include <fcntl.h>
+
+#include "ida-mem-types.h"
+#include "ida-manager.h"
+#include "ida-combine.h"
+#include "ida-coalesce.h"
+
+static void ida_coalesce_completed(call_frame_t * frame, err_t error,
+                                   ida_request_t * req, uintptr_t * data)
+{
+    SYS_GF_CBK_CALL_TYPE(writev) * args;
+    ida_coalesce_t * coalesce;
+    call_stub_t * stub, * tmp;
+    struct list_head list;
+
+    coalesce = frame->local;
+    frame->local = NULL;
+
+    if ((error == 0) && (data != NULL))
+    {
+        args = (SYS_GF_CBK_CALL_TYPE(writev) *)data;
+        if (args->op_ret < 0)
+        {
+            error = (args->op_errno != 0) ? args->op_errno : EIO;
+        }
+    }
+    if (error != 0)
+    {
+        logE("Buffered write failed (error %d).", error);
+    }
+
+    INIT_LIST_HEAD(&list);
+
+    LOCK(&coalesce->pending_lock);
+
+    // The first error is kept until it can be reported by a later writev,
+    // flush or fsync on the same fd.
+    if ((error != 0) && (coalesce->error == 0))
+    {
+        coalesce->error = error;
+    }
+    if (--coalesce->pending == 0)
+    {
+        list_splice_init(&coalesce->waiting, &list);
+    }
+
+    UNLOCK(&coalesce->pending_lock);
+
+    STACK_DESTROY(frame->root);
+
+    list_for_each_entry_safe(stub, tmp, &list, list)
+    {
+        list_del_init(&stub->list);
+        call_resume(stub);
+    }
+}
+
+static ida_handlers_t ida_coalesce_handlers =
+{
+    .prepare     = ida_prepare_writev,
+    .dispatch    = ida_dispatch_write,
+    .completed   = ida_coalesce_completed,
+    .combine     = ida_combine_writev,
+    .rebuild     = ida_rebuild_writev,
+    .copy        = ida_copy_writev,
+    .fingerprint = ida_fingerprint_writev
+};
+
+void ida_coalesce_initialize(ida_coalesce_t * coalesce)
+{
+    LOCK_INIT(&coalesce->lock);
+    LOCK_INIT(&coalesce->pending_lock);
+    coalesce->frame = NULL;
+    coalesce->iobref = NULL;
+    coalesce->data = NULL;
+    coalesce->offset = 0;
+    coalesce->size = 0;
+    coalesce->delay = NULL;
+    coalesce->pending = 0;
+    coalesce->error = 0;
+    INIT_LIST_HEAD(&coalesce->waiting);
+}
+
+void ida_coalesce_terminate(ida_coalesce_t * coalesce)
+{
+    // The fd is kept referenced while there is buffered data, so nothing
+    // should remain here.
+    if (coalesce->size > 0)
+    {
+        logW("Discarding %zu bytes of buffered writes at offset %" PRId64,
+             coalesce->size, coalesce->offset);
+    }
+    if (coalesce->iobref != NULL)
+    {
+        iobref_unref(coalesce->iobref);
+        coalesce->iobref = NULL;
+    }
+    if (coalesce->frame != NULL)
+    {
+        STACK_DESTROY(coalesce->frame->root);
+        coalesce->frame = NULL;
+    }
+
+    LOCK_DESTROY(&coalesce->lock);
+    LOCK_DESTROY(&coalesce->pending_lock);
+}
+
+ida_coalesce_t * ida_coalesce_get(xlator_t * xl, fd_t * fd)
+{
+    ida_private_t * ida;
+    ida_fd_ctx_t * ctx;
+    uint64_t value;
+
+    ida = xl->private;
+    if ((ida->coalesce_size == 0) || (fd == NULL))
+    {
+        return NULL;
+    }
+    if ((fd_ctx_get(fd, xl, &value) != 0) || (value == 0))
+    {
+        return NULL;
+    }
+    ctx = (ida_fd_ctx_t *)(uintptr_t)value;
+
+    // Files opened for synchronous or direct I/O are never buffered.
+    if ((ctx->flags & (O_SYNC | O_DSYNC | O_DIRECT)) != 0)
+    {
+        return NULL;
+    }
+
+    return &ctx->coalesce;
+}
+
+static int32_t ida_coalesce_take_error(ida_coalesce_t * coalesce)
+{
+    int32_t error;
+
+    LOCK(&coalesce->pending_lock);
+
+    error = coalesce->error;
+    coalesce->error = 0;
+
+    UNLOCK(&coalesce->pending_lock);
+
+    return error;
+}
+
+static bool __ida_coalesce_allocate(xlator_t * xl, ida_coalesce_t * coalesce,
+                                    call_frame_t * frame)
+{
+    ida_private_t * ida;
+    struct iobuf * iobuf;
+
+    ida = xl->private;
+
+    // The buffered data is sent using a copy of the frame of the first write,
+    // so that it's written with the same credentials.
+    SYS_PTR(
+        &coalesce->frame, copy_frame, (frame),
+        ENOMEM,
+        E(),
+        GOTO(failed)
+    );
+    SYS_PTR(
+        &coalesce->iobref, iobref_new, (),
+        ENOMEM,
+        E(),
+        GOTO(failed_frame)
+    );
+    SYS_PTR(
+        &iobuf, iobuf_get2, (xl->ctx->iobuf_pool, ida->coalesce_size),
+        ENOMEM,
+        E(),
+        GOTO(failed_iobref)
+    );
+    SYS_CODE(
+        iobref_add, (coalesce->iobref, iobuf),
+        ENOMEM,
+        E(),
+        GOTO(failed_iobuf)
+    );
+    coalesce->data = iobuf->ptr;
+    iobuf_unref(iobuf);
+
+    return true;
+
+failed_iobuf:
+    iobuf_unref(iobuf);
+failed_iobref:
+    iobref_unref(coalesce->iobref);
+    coalesce->iobref = NULL;
+failed_frame:
+    STACK_DESTROY(coalesce->frame->root);
+    coalesce->frame = NULL;
+failed:
+    return false;
+}
+
+// Sends all buffered data as a single write. It's called with the lock held
+// so that buffered writes reach the bricks in the same order they were
+// received.
+static void __ida_coalesce_send(xlator_t * xl, fd_t * fd,
+                                ida_coalesce_t * coalesce)
+{
+    ida_private_t * ida;
+    call_frame_t * frame;
+    struct iobref * iobref;
+    struct iovec vector;
+
+    if (coalesce->size == 0)
+    {
+        return;
+    }
+
+    ida = xl->private;
+
+    frame = coalesce->frame;
+    frame->local = coalesce;
+    iobref = coalesce->iobref;
+    vector.iov_base = coalesce->data;
+    vector.iov_len = coalesce->size;
+
+    LOCK(&coalesce->pending_lock);
+    coalesce->pending++;
+    UNLOCK(&coalesce->pending_lock);
+
+    SYS_ASYNC(ida_writev, (frame, xl, &ida_coalesce_handlers, IDA_USE_DFC,
+                           ida_get_bad(xl, NULL, NULL, fd), ida->fragments,
+                           ida->fragments, NULL, NULL, fd, fd, &vector, 1,
+                           coalesce->offset, 0, iobref, NULL));
+
+    iobref_unref(iobref);
+
+    coalesce->frame = NULL;
+    coalesce->iobref = NULL;
+    coalesce->data = NULL;
+    coalesce->size = 0;
+}
+
+SYS_DELAY_CREATE(ida_coalesce_timeout, ((xlator_t *, xl), (fd_t *, fd)))
+{
+    ida_coalesce_t * coalesce;
+
+    coalesce = ida_coalesce_get(xl, fd);
+    if (coalesce != NULL)
+    {
+        LOCK(&coalesce->lock);
+
+        if (coalesce->delay != NULL)
+        {
+            sys_delay_release(coalesce->delay);
+            coalesce->delay = NULL;
+        }
+        __ida_coalesce_send(xl, fd, coalesce);
+
+        UNLOCK(&coalesce->lock);
+    }
+
+    fd_unref(fd);
+}
+
+// Returns the number of bytes buffered, 0 if the write must be processed as
+// usual, or a negative error code of a previous buffered write that has not
+// been reported yet. In all cases, data buffered before is sent to the bricks
+// before any non-buffered write.
+int32_t ida_coalesce_writev(xlator_t * xl, fd_t * fd, call_frame_t * frame,
+                            struct iovec * vector, int32_t count,
+                            off_t offset, uint32_t flags, dict_t * xdata)
+{
+    ida_private_t * ida;
+    ida_coalesce_t * coalesce;
+    size_t size;
+    int32_t ret;
+
+    coalesce = ida_coalesce_get(xl, fd);
+    if (coalesce == NULL)
+    {
+        return 0;
+    }
+
+    ret = ida_coalesce_take_error(coalesce);
+    if (ret != 0)
+    {
+        return -ret;
+    }
+
+    ida = xl->private;
+    size = iov_length(vector, count);
+
+    LOCK(&coalesce->lock);
+
+    if ((coalesce->size > 0) &&
+        ((offset != coalesce->offset + coalesce->size) ||
+         (coalesce->size + size > ida->coalesce_size)))
+    {
+        __ida_coalesce_send(xl, fd, coalesce);
+    }
+
+    // Synchronous writes, writes carrying extra data and writes that would
+    // fill the whole buffer by themselves are not buffered.
+    if ((size == 0) || (size >= ida->coalesce_size) || (xdata != NULL) ||
+        ((flags & (O_SYNC | O_DSYNC | O_DIRECT)) != 0))
+    {
+        goto done;
+    }
+    if (coalesce->size == 0)
+    {
+        if (!__ida_coalesce_allocate(xl, coalesce, frame))
+        {
+            goto done;
+        }
+        coalesce->offset = offset;
+    }
+
+    iov_unload((char *)coalesce->data + coalesce->size, vector, count);
+    coalesce->size += size;
+    ret = size;
+
+    if (coalesce->size == ida->coalesce_size)
+    {
+        __ida_coalesce_send(xl, fd, coalesce);
+    }
+    else if (coalesce->delay == NULL)
+    {
+        // The timer keeps a reference to the fd until it's executed.
+        coalesce->delay = SYS_DELAY(ida->coalesce_timeout,
+                                    ida_coalesce_timeout, (xl, fd_ref(fd)),
+                                    1);
+        if (coalesce->delay == NULL)
+        {
+            fd_unref(fd);
+            __ida_coalesce_send(xl, fd, coalesce);
+        }
+    }
+
+done:
+    UNLOCK(&coalesce->lock);
+
+    return ret;
+}
+
+void ida_coalesce_flush(xlator_t * xl, fd_t * fd)
+{
+    ida_coalesce_t * coalesce;
+
+    coalesce = ida_coalesce_get(xl, fd);
+    if (coalesce != NULL)
+    {
+        LOCK(&coalesce->lock);
+        __ida_coalesce_send(xl, fd, coalesce);
+        UNLOCK(&coalesce->lock);
+    }
+}
+
+// Sends the buffered data of the fd. If some buffered write has not finished
+// yet, 'stub' is queued to be resumed once all of them have finished and true
+// is returned.
+bool ida_coalesce_wait(xlator_t * xl, fd_t * fd, call_stub_t * stub)
+{
+    ida_coalesce_t * coalesce;
+    bool waiting;
+
+    coalesce = ida_coalesce_get(xl, fd);
+    if (coalesce == NULL)
+    {
+        return false;
+    }
+
+    LOCK(&coalesce->lock);
+    __ida_coalesce_send(xl, fd, coalesce);
+    UNLOCK(&coalesce->lock);
+
+    waiting = false;
+    if (stub != NULL)
+    {
+        LOCK(&coalesce->pending_lock);
+
+        if (coalesce->pending > 0)
+        {
+            list_add_tail(&stub->list, &coalesce->waiting);
+            waiting = true;
+        }
+
+        UNLOCK(&coalesce->pending_lock);
+    }
+
+    return waiting;
+}
+
+// Returns true if writes can be buffered and the inode has some open fd.
+bool ida_coalesce_inode_active(xlator_t * xl, inode_t * inode)
+{
+    ida_private_t * ida;
+    bool active;
+
+    ida = xl->private;
+    if ((ida->coalesce_size == 0) || (inode == NULL))
+    {
+        return false;
+    }
+
+    LOCK(&inode->lock);
+    active = !list_empty(&inode->fd_list);
+    UNLOCK(&inode->lock);
+
+    return active;
+}
+
+// Sends the buffered data of all fds of the inode, for fops received by
+// path. 'stub' is queued in the first fd that still has buffered writes in
+// flight and true is returned. The resumed fop must call this function
+// again to wait for the remaining fds.
+bool ida_coalesce_wait_inode(xlator_t * xl, inode_t * inode,
+                             call_stub_t * stub)
+{
+    fd_t ** fds, * fd;
+    int32_t count, i;
+    bool waiting;
+
+    count = 0;
+
+    LOCK(&inode->lock);
+    list_for_each_entry(fd, &inode->fd_list, inode_list)
+    {
+        count++;
+    }
+    UNLOCK(&inode->lock);
+
+    if (count == 0)
+    {
+        return false;
+    }
+    SYS_CALLOC0(
+        &fds, count, ida_mt_uint8_t,
+        E(),
+        RETVAL(false)
+    );
+
+    // fds opened meanwhile are ignored. They can't have buffered writes
+    // received before this fop.
+    i = 0;
+
+    LOCK(&inode->lock);
+    list_for_each_entry(fd, &inode->fd_list, inode_list)
+    {
+        if (i == count)
+        {
+            break;
+        }
+        fds[i++] = __fd_ref(fd);
+    }
+    UNLOCK(&inode->lock);
+
+    count = i;
+    waiting = false;
+    for (i = 0; i < count; i++)
+    {
+        if (!waiting)
+        {
+            waiting = ida_coalesce_wait(xl, fds[i], stub);
+        }
+        else
+        {
+            ida_coalesce_flush(xl, fds[i]);
+        }
+        fd_unref(fds[i]);
+    }
+
+    SYS_FREE(fds);
+
+    return waiting;
+}
+
+int32_t ida_coalesce_error(xlator_t * xl, fd_t * fd)
+{
+    ida_coalesce_t * coalesce;
+
+    coalesce = ida_coalesce_get(xl, fd);
+    if (coalesce == NULL)
+    {
+        return 0;
+    }
+
+    return ida_coalesce_take_error(coalesce);
+}
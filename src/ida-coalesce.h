@@ -0,0 +1,44 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_COALESCE_H__
+#define __IDA_COALESCE_H__
+
+#include "xlator.h"
+#include "call-stub.h"
+
+#include "ida-types.h"
+
+void ida_coalesce_initialize(ida_coalesce_t * coalesce);
+void ida_coalesce_terminate(ida_coalesce_t * coalesce);
+
+ida_coalesce_t * ida_coalesce_get(xlator_t * xl, fd_t * fd);
+
+int32_t ida_coalesce_writev(xlator_t * xl, fd_t * fd, call_frame_t * frame,
+                            struct iovec * vector, int32_t count,
+                            off_t offset, uint32_t flags, dict_t * xdata);
+void ida_coalesce_flush(xlator_t * xl, fd_t * fd);
+bool ida_coalesce_wait(xlator_t * xl, fd_t * fd, call_stub_t * stub);
+bool ida_coalesce_inode_active(xlator_t * xl, inode_t * inode);
+bool ida_coalesce_wait_inode(xlator_t * xl, inode_t * inode,
+                             call_stub_t * stub);
+int32_t ida_coalesce_error(xlator_t * xl, fd_t * fd);
+
+#endif /* __IDA_COALESCE_H__ */
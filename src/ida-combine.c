@@ -33,6 +33,8 @@
 #include "ida-type-statvfs.h"
 #include "ida-manager.h"
 #include "ida-rabin.h"
+#include "ida-coalesce.h"
+#include "ida-pool.h"
 
 bool ida_error_check(char * fop, int32_t dst_ret, int32_t src_ret,
                      int32_t dst_errno, int32_t src_errno,
@@ -68,6 +70,31 @@ bool ida_error_check(char * fop, int32_t dst_ret, int32_t src_ret,
     return true;
 }
 
+// Summary of the fields that ida_error_check() and ida_iatt_combine()
+// compare. Answers with different fingerprints would never pass the checks.
+// 'iatt' is the main iatt of the answer, if it has one.
+uint64_t ida_answer_fingerprint(int32_t op_ret, int32_t op_errno,
+                                dict_t * xdata, struct iatt * iatt)
+{
+    uint64_t hash;
+
+    hash = (uint64_t)(uint32_t)op_ret << 32;
+    if (op_ret >= 0)
+    {
+        hash ^= ida_dict_hash(xdata);
+        if (iatt != NULL)
+        {
+            hash ^= ida_iatt_hash(iatt) * 0x9e3779b97f4a7c15ULL;
+        }
+    }
+    else
+    {
+        hash ^= (uint32_t)op_errno;
+    }
+
+    return hash;
+}
+
 bool ida_prepare_access(ida_private_t * ida, ida_request_t * req)
 {
     return true;
@@ -531,9 +558,9 @@ bool ida_combine_lookup(ida_request_t * req, uint32_t idx, ida_answer_t * ans,
                         uintptr_t * data)
 {
     struct iatt buf, postparent;
-    ida_answer_t * next;
     SYS_GF_CBK_CALL_TYPE(lookup) * dst;
     SYS_GF_WIND_CBK_TYPE(lookup) * src;
+    data_t * content;
 
     dst = (SYS_GF_CBK_CALL_TYPE(lookup) *)((uintptr_t *)ans + IDA_ANS_SIZE);
     src = (SYS_GF_WIND_CBK_TYPE(lookup) *)data;
@@ -553,15 +580,16 @@ bool ida_combine_lookup(ida_request_t * req, uint32_t idx, ida_answer_t * ans,
             return false;
         }
 
+        // Only the content of the file, if any, is needed to rebuild the
+        // answer.
+        if ((sys_dict_get(src->xdata, GF_CONTENT_KEY, &content) == 0) &&
+            !ida_fragment_add(ans, idx, NULL, 0, NULL, content))
+        {
+            return false;
+        }
+
         memcpy(&dst->buf, &buf, sizeof(dst->buf));
         memcpy(&dst->postparent, &postparent, sizeof(dst->postparent));
-
-        next = req->handlers->copy(data);
-        next->count = 0;
-        next->id = idx;
-        next->next = ans->next;
-
-        ans->next = next;
     }
 
     return true;
@@ -570,12 +598,12 @@ bool ida_combine_lookup(ida_request_t * req, uint32_t idx, ida_answer_t * ans,
 int32_t ida_rebuild_lookup(ida_private_t * ida, ida_request_t * req,
                            ida_answer_t * ans)
 {
-    SYS_GF_CBK_CALL_TYPE(lookup) * args, * tmp;
-    ida_answer_t * item;
+    SYS_GF_CBK_CALL_TYPE(lookup) * args;
+    ida_fragment_t * fragment;
     uint8_t * blocks[ans->count];
     uint32_t values[ans->count];
     uint8_t * buff;
-    data_t * data;
+    data_t * data, * content;
     size_t size;
     int32_t i;
 
@@ -596,20 +624,31 @@ int32_t ida_rebuild_lookup(ida_private_t * ida, ida_request_t * req,
         }
 
         size = SIZE_MAX;
-        for (i = 0, item = ans;
-             (item != NULL) && (i < ida->fragments);
-             item = item->next)
+        i = 0;
+
+        // The content of the first answer is removed from its xdata below,
+        // so a reference is kept while it's being used.
+        content = NULL;
+        if (sys_dict_get(args->xdata, GF_CONTENT_KEY, &data) == 0)
+        {
+            content = data_ref(data);
+            values[i] = ans->id;
+            blocks[i] = (uint8_t *)content->data;
+            size = content->len;
+            i++;
+        }
+        for (fragment = ans->fragments;
+             (fragment != NULL) && (i < ida->fragments);
+             fragment = fragment->next)
         {
-            tmp = (SYS_GF_CBK_CALL_TYPE(lookup) *)((uintptr_t *)item +
-                                                   IDA_ANS_SIZE);
-            if (sys_dict_get(tmp->xdata, GF_CONTENT_KEY, &data) == 0)
+            if (fragment->data != NULL)
             {
-                values[i] = item->id;
-                blocks[i] = (uint8_t *)data->data;
+                values[i] = fragment->id;
+                blocks[i] = (uint8_t *)fragment->data->data;
 
-                if (size > data->len)
+                if (size > fragment->data->len)
                 {
-                    size = data->len;
+                    size = fragment->data->len;
                 }
 
                 i++;
@@ -629,7 +668,13 @@ int32_t ida_rebuild_lookup(ida_private_t * ida, ida_request_t * req,
                     GOTO(done)
                 );
 
-                ida_rabin_merge(size, ida->fragments, values, blocks, buff);
+                SYS_TEST(
+                    ida_rabin_merge(&ida->rabin, size, values, blocks,
+                                    buff) > 0,
+                    ENOMEM,
+                    E(),
+                    GOTO(failed_buff)
+                );
 
                 size *= ida->fragments;
                 if (size > req->size)
@@ -651,18 +696,23 @@ int32_t ida_rebuild_lookup(ida_private_t * ida, ida_request_t * req,
                 );
             }
         }
-    }
 
-done:
-    return 0;
+        goto done;
 
-failed_buff:
-    SYS_FREE(buff);
+    failed_buff:
+        SYS_FREE(buff);
 
-    return 0;
+        goto done;
 
-failed_data:
-    data_unref(data);
+    failed_data:
+        data_unref(data);
+
+    done:
+        if (content != NULL)
+        {
+            data_unref(content);
+        }
+    }
 
     return 0;
 }
@@ -794,6 +844,7 @@ err_t ida_fd_ctx_create(fd_t * fd, xlator_t * xl, loc_t * loc)
         E(),
         GOTO(failed, &error)
     );
+    ida_coalesce_initialize(&ctx->coalesce);
     value = (uint64_t)(uintptr_t)ctx;
     SYS_CODE(
         fd_ctx_set, (fd, xl, value),
@@ -805,6 +856,7 @@ err_t ida_fd_ctx_create(fd_t * fd, xlator_t * xl, loc_t * loc)
     return 0;
 
 failed_loc:
+    ida_coalesce_terminate(&ctx->coalesce);
     loc_wipe(&ctx->loc);
 failed:
     SYS_FREE(ctx);
@@ -1182,6 +1234,13 @@ bool ida_prepare_readv(ida_private_t * ida, ida_request_t * req)
     req->data = head;
     req->size = args->size;
 
+    // On a systematic code the first fragments contain plain data, so they
+    // are read whenever possible to avoid decoding.
+    if (ida->systematic)
+    {
+        req->preferred = (1ULL << ida->fragments) - 1ULL;
+    }
+
     args->offset = offs / ida->fragments;
     args->size = size / ida->fragments;
 
@@ -1192,7 +1251,6 @@ bool ida_combine_readv(ida_request_t * req, uint32_t idx, ida_answer_t * ans,
                        uintptr_t * data)
 {
     struct iatt stbuf;
-    ida_answer_t * next;
     SYS_GF_CBK_CALL_TYPE(readv) * dst;
     SYS_GF_WIND_CBK_TYPE(readv) * src;
 
@@ -1207,175 +1265,365 @@ bool ida_combine_readv(ida_request_t * req, uint32_t idx, ida_answer_t * ans,
 
     if (dst->op_ret >= 0)
     {
-        if (!ida_iatt_combine(&stbuf, &dst->stbuf, &src->stbuf))
+        if (!ida_iatt_combine(&stbuf, &dst->stbuf, &src->stbuf) ||
+            !ida_fragment_add(ans, idx, src->vector.iovec, src->vector.count,
+                              src->iobref, NULL))
         {
             return false;
         }
 
         memcpy(&dst->stbuf, &stbuf, sizeof(dst->stbuf));
-
-        next = req->handlers->copy(data);
-        next->count = 0;
-        next->id = idx;
-        next->next = ans->next;
-
-        ans->next = next;
     }
 
     return true;
 }
 
-int32_t ida_rebuild_readv(ida_private_t * ida, ida_request_t * req,
-                          ida_answer_t * ans)
-{
-    SYS_GF_FOP_CALL_TYPE(readv) * fop;
-    SYS_GF_CBK_CALL_TYPE(readv) * args, * tmp;
-    ida_answer_t * item;
-    uint8_t * ptr;
-    uint8_t * blocks[ans->count];
-    uint8_t * ptrs[ans->count];
-    uint32_t values[ans->count];
-    struct iobref * iobref;
-    struct iobuf * iobuf;
-    size_t size, min, max, slice;
-    int32_t i, j;
-
-    memset(blocks, 0, sizeof(blocks));
+// State of a read while the original data is being decoded. Each slice of
+// the answer is decoded as an independent chunk of a worker job.
+typedef struct
+{
+    ida_worker_job_t job;
+    ida_private_t *  ida;
+    ida_request_t *  req;
+    ida_answer_t *   ans;
+    struct iobref *  iobref;
+    size_t           size;
+    size_t           maxsize;
+    int32_t          count;
+    int32_t          slices;
+    int32_t          result;
+    struct iovec **  iovecs;
+    int32_t *        counts;
+    uint32_t *       values;
+    struct iovec *   vector;
+} ida_read_t;
+
+// The data of each fragment is taken directly from the iovecs received from
+// the bricks. Only groups that are split between two iovecs, or that are not
+// aligned, are copied to a temporary buffer before decoding them. It's only
+// allocated when some group needs it.
+static void ida_rebuild_readv_decode(ida_worker_job_t * job, uint32_t index)
+{
+    ida_read_t * read;
+    ida_iov_cursor_t cursors[IDA_RABIN_MAX_ROWS];
+    uint8_t * ptrs[IDA_RABIN_MAX_ROWS];
+    uint8_t * out, * bounce;
+    size_t slice, size, length;
+    uint64_t start;
+    int32_t i;
 
-    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+    read = (ida_read_t *)job;
+    start = ida_time_now();
 
-    if (args->op_ret >= 0)
+    slice = read->size - index * read->maxsize;
+    if (slice > read->maxsize)
     {
-        struct iovec vector[args->vector.count * ida->fragments];
+        slice = read->maxsize;
+    }
+    for (i = 0; i < read->count; i++)
+    {
+        ida_iov_cursor_init(&cursors[i], read->iovecs[i], read->counts[i],
+                            index * read->maxsize);
+    }
 
-        ida_iatt_rebuild(ida, &args->stbuf, ans->count);
+    out = read->vector[index].iov_base;
+    bounce = NULL;
 
-        min = SIZE_MAX;
-        for (i = 0, item = ans; item != NULL; i++, item = item->next)
+    while (slice > 0)
+    {
+        size = slice;
+        for (i = 0; i < read->count; i++)
         {
-            tmp = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)item +
-                                                  IDA_ANS_SIZE);
-            values[i] = item->id;
-            size = iov_length(tmp->vector.iovec, tmp->vector.count);
-            if (min > size)
+            length = ida_iov_cursor_contiguous(&cursors[i], &ptrs[i]);
+            if (size > length)
             {
-                min = size;
+                size = length;
             }
-            SYS_ALLOC_ALIGNED(
-                &ptr, size, 16, sys_mt_uint8_t,
-                E(),
-                GOTO(failed)
-            );
-            ptrs[i] = blocks[i] = ptr;
-            for (j = 0; j < tmp->vector.count; j++)
+        }
+        size -= size % (IDA_GF_BITS * 16);
+        if (size > 0)
+        {
+            for (i = 0; i < read->count; i++)
             {
-                memcpy(ptr, tmp->vector.iovec[j].iov_base,
-                       tmp->vector.iovec[j].iov_len);
-                ptr += tmp->vector.iovec[j].iov_len;
+                ida_iov_cursor_advance(&cursors[i], NULL, size);
             }
         }
-        size = min % (ida->block_size / ida->fragments);
-        min -= size;
-
-        SYS_PTR(
-            &iobref, iobref_new, (),
-            ENOMEM,
-            E(),
-            GOTO(failed)
-        );
-        size = min;
-        max = iobpool_default_pagesize(
-                                (struct iobuf_pool *)ida->xl->ctx->iobuf_pool);
-        max /= ida->fragments;
-        j = 0;
-        do
+        else
         {
-            SYS_PTR(
-                &iobuf, iobuf_get, (ida->xl->ctx->iobuf_pool),
-                ENOMEM,
-                E(),
-                GOTO(failed_iobref)
-            );
-            SYS_CODE(
-                iobref_add, (iobref, iobuf),
-                ENOMEM,
-                E(),
-                GOTO(failed_iobuf)
-            );
-
-            slice = size;
-            if (slice > max)
+            size = slice;
+            if (size > IDA_BOUNCE_SIZE)
             {
-                slice = max;
+                size = IDA_BOUNCE_SIZE;
             }
-            ida_rabin_merge(slice, ida->fragments, values, ptrs, iobuf->ptr);
+            if (bounce == NULL)
+            {
+                bounce = ida_pool_alloc(read->count * IDA_BOUNCE_SIZE);
+                if (bounce == NULL)
+                {
+                    read->result = -1;
 
-            size -= slice;
-            for (i = 0; i < ans->count; i++)
+                    goto done;
+                }
+            }
+            for (i = 0; i < read->count; i++)
             {
-                ptrs[i] += slice;
+                ptrs[i] = bounce + i * IDA_BOUNCE_SIZE;
+                ida_iov_cursor_advance(&cursors[i], ptrs[i], size);
             }
-            vector[j].iov_base = iobuf->ptr;
-            vector[j].iov_len = slice * ida->fragments;
-            j++;
-
-            iobuf_unref(iobuf);
-        } while (size > 0);
+        }
 
-        for (i = 0; i < ans->count; i++)
+        if (ida_rabin_merge(&read->ida->rabin, size, read->values, ptrs,
+                            out) == 0)
         {
-            SYS_FREE_ALIGNED(blocks[i]);
+            read->result = -1;
+
+            goto done;
         }
 
-        vector[0].iov_base += req->data;
-        size = min * ida->fragments - req->data;
-        fop = (SYS_GF_FOP_CALL_TYPE(readv) *)((uintptr_t *)req + IDA_REQ_SIZE);
-        max = fop->offset * ida->fragments + req->data + req->size;
-        if (max > args->stbuf.ia_size)
+        out += size * read->ida->fragments;
+        slice -= size;
+    }
+
+    ida_stats_add(&read->ida->stats, IDA_STATS_DECODED,
+                  (out - (uint8_t *)read->vector[index].iov_base));
+    ida_stats_add(&read->ida->stats, IDA_STATS_DECODE_TIME,
+                  ida_time_now() - start);
+
+done:
+    if (bounce != NULL)
+    {
+        ida_pool_free(bounce);
+    }
+}
+
+static void ida_rebuild_readv_done(ida_worker_job_t * job)
+{
+    SYS_GF_FOP_CALL_TYPE(readv) * fop;
+    SYS_GF_CBK_CALL_TYPE(readv) * args;
+    ida_read_t * read;
+    ida_private_t * ida;
+    ida_request_t * req;
+    size_t size, max;
+    int32_t j;
+
+    read = (ida_read_t *)job;
+    ida = read->ida;
+    req = read->req;
+
+    if (read->result < 0)
+    {
+        logE("Unable to decode data.");
+        iobref_unref(read->iobref);
+
+        goto done;
+    }
+
+    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)read->ans +
+                                           IDA_ANS_SIZE);
+
+    j = read->slices;
+    read->vector[0].iov_base += req->data;
+    size = read->size * ida->fragments - req->data;
+    fop = (SYS_GF_FOP_CALL_TYPE(readv) *)((uintptr_t *)req + IDA_REQ_SIZE);
+    max = fop->offset * ida->fragments + req->data + req->size;
+    if (max > args->stbuf.ia_size)
+    {
+        max -= args->stbuf.ia_size;
+        if (max > req->size)
         {
-            max -= args->stbuf.ia_size;
-            if (max > req->size)
-            {
-                max = req->size;
-            }
-            req->size -= max;
+            max = req->size;
         }
-        while (size > req->size)
+        req->size -= max;
+    }
+    while (size > req->size)
+    {
+        if (size - req->size >= read->vector[j - 1].iov_len)
         {
-            if (size - req->size >= vector[j - 1].iov_len)
-            {
-                size -= vector[--j].iov_len;
-            }
-            else
-            {
-                vector[j - 1].iov_len -= size - req->size;
-                size = req->size;
-            }
+            size -= read->vector[--j].iov_len;
         }
+        else
+        {
+            read->vector[j - 1].iov_len -= size - req->size;
+            size = req->size;
+        }
+    }
 
+    iobref_unref(args->iobref);
+    args->iobref = read->iobref;
+    sys_iovec_acquire(&args->vector, read->vector, j);
 
-        iobref_unref(args->iobref);
-        args->iobref = iobref;
-        sys_iovec_acquire(&args->vector, vector, j);
+    args->op_ret = size;
+
+done:
+    ida_rebuild_done(req, read->ans, read->result);
 
-        args->op_ret = size;
+    ida_pool_free(read);
+}
+
+int32_t ida_rebuild_readv(ida_private_t * ida, ida_request_t * req,
+                          ida_answer_t * ans)
+{
+    SYS_GF_CBK_CALL_TYPE(readv) * args;
+    ida_fragment_t * fragment;
+    ida_read_t * read;
+    struct iobuf * iobuf;
+    size_t size, min, max, slice;
+    int32_t i, j, slices, count;
+
+    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+
+    if (args->op_ret < 0)
+    {
+        return 0;
     }
 
-    return 0;
+    ida_iatt_rebuild(ida, &args->stbuf, ans->count);
+
+    min = iov_length(args->vector.iovec, args->vector.count);
+    for (fragment = ans->fragments; fragment != NULL;
+         fragment = fragment->next)
+    {
+        size = iov_length(fragment->vector, fragment->count);
+        if (min > size)
+        {
+            min = size;
+        }
+    }
+    min -= min % (ida->block_size / ida->fragments);
+
+    max = iobpool_default_pagesize(
+                                (struct iobuf_pool *)ida->xl->ctx->iobuf_pool);
+    max /= ida->fragments;
+    // Slices must contain whole groups of each fragment, otherwise the
+    // remainder of each one couldn't be decoded.
+    max -= max % (ida->block_size / ida->fragments);
+    slices = (min + max - 1) / max;
+    if (slices == 0)
+    {
+        slices = 1;
+    }
+
+    // Only the minimum number of fragments is needed to decode the data.
+    count = ida->fragments;
+    SYS_PTR(
+        &read, ida_pool_alloc,
+        (sizeof(ida_read_t) + slices * sizeof(struct iovec) +
+         count * (sizeof(struct iovec *) + sizeof(int32_t) +
+                  sizeof(uint32_t))),
+        ENOMEM,
+        E(),
+        RETVAL(-1)
+    );
+    read->ida = ida;
+    read->req = req;
+    read->ans = ans;
+    read->size = min;
+    read->maxsize = max;
+    read->count = count;
+    read->slices = slices;
+    read->result = 0;
+    read->vector = (struct iovec *)(read + 1);
+    read->iovecs = (struct iovec **)(read->vector + slices);
+    read->counts = (int32_t *)(read->iovecs + count);
+    read->values = (uint32_t *)(read->counts + count);
+
+    // Answers and their fragments are kept until the request is destroyed,
+    // so their buffers can be used until the decoding finishes.
+    read->values[0] = ans->id;
+    read->iovecs[0] = args->vector.iovec;
+    read->counts[0] = args->vector.count;
+    for (i = 1, fragment = ans->fragments; i < count;
+         i++, fragment = fragment->next)
+    {
+        read->values[i] = fragment->id;
+        read->iovecs[i] = fragment->vector;
+        read->counts[i] = fragment->count;
+    }
+
+    SYS_PTR(
+        &read->iobref, iobref_new, (),
+        ENOMEM,
+        E(),
+        GOTO(failed)
+    );
+    size = min;
+    for (j = 0; j < slices; j++)
+    {
+        SYS_PTR(
+            &iobuf, iobuf_get, (ida->xl->ctx->iobuf_pool),
+            ENOMEM,
+            E(),
+            GOTO(failed_iobref)
+        );
+        SYS_CODE(
+            iobref_add, (read->iobref, iobuf),
+            ENOMEM,
+            E(),
+            GOTO(failed_iobuf)
+        );
+
+        slice = size;
+        if (slice > max)
+        {
+            slice = max;
+        }
+        read->vector[j].iov_base = iobuf->ptr;
+        read->vector[j].iov_len = slice * ida->fragments;
+        size -= slice;
+
+        iobuf_unref(iobuf);
+    }
+
+    // Big reads are decoded by the coding threads. The answer is completed
+    // from the thread that finishes the decoding.
+    ida_worker_run(ida_get_workers(ida, min * ida->fragments), &read->job,
+                   slices, ida_rebuild_readv_decode, ida_rebuild_readv_done);
+
+    return IDA_REBUILD_ASYNC;
 
 failed_iobuf:
     iobuf_unref(iobuf);
 failed_iobref:
-    iobref_unref(iobref);
+    iobref_unref(read->iobref);
 failed:
-    for (i = 0; i < ans->count; i++)
+    ida_pool_free(read);
+
+    return -1;
+}
+
+// Used when the fragments themselves are needed instead of the original data.
+// They are kept in the answer, and only their common length is computed.
+int32_t ida_rebuild_readv_fragments(ida_private_t * ida, ida_request_t * req,
+                                    ida_answer_t * ans)
+{
+    SYS_GF_CBK_CALL_TYPE(readv) * args;
+    ida_fragment_t * fragment;
+    size_t size, min;
+
+    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+
+    if (args->op_ret < 0)
+    {
+        return 0;
+    }
+
+    ida_iatt_rebuild(ida, &args->stbuf, ans->count);
+
+    min = iov_length(args->vector.iovec, args->vector.count);
+    for (fragment = ans->fragments; fragment != NULL;
+         fragment = fragment->next)
     {
-        if (blocks[i] != NULL)
+        size = iov_length(fragment->vector, fragment->count);
+        if (min > size)
         {
-            SYS_FREE_ALIGNED(blocks[i]);
+            min = size;
         }
     }
-    return -1;
+    min -= min % (ida->block_size / ida->fragments);
+
+    args->op_ret = min;
+
+    return 0;
 }
 
 bool ida_prepare_rename(ida_private_t * ida, ida_request_t * req)
@@ -1802,6 +2050,17 @@ int32_t ida_rebuild_symlink(ida_private_t * ida, ida_request_t * req,
     return 0;
 }
 
+// Truncating a file modifies its last block without knowing its contents, so
+// no cached block of the file can be used until the truncate finishes.
+static void ida_prepare_truncate_cache(ida_private_t * ida,
+                                       ida_request_t * req, inode_t * inode)
+{
+    if ((inode != NULL) && (req->minimum >= ida->fragments))
+    {
+        req->barrier = ida_cache_block(&ida->cache, inode->gfid);
+    }
+}
+
 bool ida_prepare_truncate(ida_private_t * ida, ida_request_t * req)
 {
     SYS_GF_FOP_CALL_TYPE(truncate) * args;
@@ -1820,6 +2079,8 @@ bool ida_prepare_truncate(ida_private_t * ida, ida_request_t * req)
     args->offset += tmp - (args->offset + tmp) % ida->block_size;
     args->offset /= ida->fragments;
 
+    ida_prepare_truncate_cache(ida, req, req->loc1.inode);
+
     return true;
 }
 
@@ -1888,6 +2149,8 @@ bool ida_prepare_ftruncate(ida_private_t * ida, ida_request_t * req)
     args->offset += tmp - (args->offset + tmp) % ida->block_size;
     args->offset /= ida->fragments;
 
+    ida_prepare_truncate_cache(ida, req, args->fd->inode);
+
     return true;
 }
 
@@ -2063,6 +2326,47 @@ int32_t ida_rebuild_writev(ida_private_t * ida, ida_request_t * req,
     return 0;
 }
 
+// The vector of the request already contains one fragment for each of the
+// subvolumes not marked as bad, in order, and the offset refers to the
+// original data.
+// Fragments are padded to whole blocks. If the caller already knows how many
+// bytes of the file they contain, it's given in DFC_XATTR_SIZE and kept, so
+// that the written region doesn't extend the file beyond its real size.
+bool ida_prepare_writev_fragments(ida_private_t * ida, ida_request_t * req)
+{
+    SYS_GF_FOP_CALL_TYPE(writev) * args;
+    uint64_t length;
+    size_t size;
+
+    args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req + IDA_REQ_SIZE);
+
+    size = iov_length(args->vector.iovec, args->vector.count);
+    size /= sys_bits_count64(ida->node_mask & ~req->bad);
+    length = size * ida->fragments;
+    if (args->xdata != NULL)
+    {
+        dict_get_uint64(args->xdata, DFC_XATTR_SIZE, &length);
+    }
+
+    SYS_CALL(
+        sys_dict_set_uint64, (&args->xdata, DFC_XATTR_OFFSET, args->offset,
+                              NULL),
+        E(),
+        RETVAL(false)
+    );
+
+    SYS_CALL(
+        sys_dict_set_uint64, (&args->xdata, DFC_XATTR_SIZE, length, NULL),
+        E(),
+        RETVAL(false)
+    );
+
+    req->size = 0;
+    args->offset /= ida->fragments;
+
+    return true;
+}
+
 bool ida_prepare_getxattr(ida_private_t * ida, ida_request_t * req)
 {
     return true;
@@ -2323,8 +2627,17 @@ int32_t ida_rebuild_fxattrop(ida_private_t * ida, ida_request_t * req,
 #define IDA_FOP_DISPATCH_ALL all
 #define IDA_FOP_DISPATCH_MIN minimum
 #define IDA_FOP_DISPATCH_MOD write
+#define IDA_FOP_DISPATCH_TRN truncate
+#define IDA_FOP_DISPATCH_OPN open
+
+#define IDA_FOP_IATT_none(_args) NULL
+#define IDA_FOP_IATT_buf(_args) (&(_args)->buf)
+#define IDA_FOP_IATT_stbuf(_args) (&(_args)->stbuf)
+#define IDA_FOP_IATT_postbuf(_args) (&(_args)->postbuf)
+#define IDA_FOP_IATT_postop_stbuf(_args) (&(_args)->postop_stbuf)
+#define IDA_FOP_IATT_postparent(_args) (&(_args)->postparent)
 
-#define IDA_GENERIC_FOP(_fop, _num) \
+#define IDA_GENERIC_FOP(_fop, _num, _iatt) \
     void ida_completed_##_fop(call_frame_t * frame, err_t error, \
                               ida_request_t * req, uintptr_t * data) \
     { \
@@ -2358,55 +2671,64 @@ int32_t ida_rebuild_fxattrop(ida_private_t * ida, ida_request_t * req,
                    ) \
                ); \
     } \
+    uint64_t ida_fingerprint_##_fop(uintptr_t * io) \
+    { \
+        SYS_GF_WIND_CBK_TYPE(_fop) * args; \
+        args = (SYS_GF_WIND_CBK_TYPE(_fop) *)io; \
+        return ida_answer_fingerprint(args->op_ret, args->op_errno, \
+                                      args->xdata, \
+                                      IDA_FOP_IATT_##_iatt(args)); \
+    } \
     ida_handlers_t ida_handlers_##_fop = \
     { \
-        .prepare   = SYS_GLUE(ida_prepare_, _fop), \
-        .dispatch  = SYS_GLUE(ida_dispatch_, IDA_FOP_DISPATCH_##_num), \
-        .completed = SYS_GLUE(ida_completed_, _fop), \
-        .combine   = SYS_GLUE(ida_combine_, _fop), \
-        .rebuild   = SYS_GLUE(ida_rebuild_, _fop), \
-        .copy      = SYS_GLUE(ida_copy_, _fop), \
-    }
-
-IDA_GENERIC_FOP(access,       INC);
-IDA_GENERIC_FOP(create,       ALL);
-IDA_GENERIC_FOP(entrylk,      ALL);
-IDA_GENERIC_FOP(fentrylk,     ALL);
-IDA_GENERIC_FOP(flush,        ALL);
-IDA_GENERIC_FOP(fsync,        ALL);
-IDA_GENERIC_FOP(fsyncdir,     ALL);
-IDA_GENERIC_FOP(getxattr,     INC);
-IDA_GENERIC_FOP(fgetxattr,    INC);
-IDA_GENERIC_FOP(inodelk,      ALL);
-IDA_GENERIC_FOP(finodelk,     ALL);
-IDA_GENERIC_FOP(link,         ALL);
-IDA_GENERIC_FOP(lk,           ALL);
-IDA_GENERIC_FOP(lookup,       ALL);
-IDA_GENERIC_FOP(mkdir,        ALL);
-IDA_GENERIC_FOP(mknod,        ALL);
-IDA_GENERIC_FOP(open,         ALL);
-IDA_GENERIC_FOP(opendir,      ALL);
-IDA_GENERIC_FOP(rchecksum,    MIN);
-IDA_GENERIC_FOP(readdir,      INC);
-IDA_GENERIC_FOP(readdirp,     INC);
-IDA_GENERIC_FOP(readlink,     INC);
-IDA_GENERIC_FOP(readv,        MIN);
-IDA_GENERIC_FOP(removexattr,  ALL);
-IDA_GENERIC_FOP(fremovexattr, ALL);
-IDA_GENERIC_FOP(rename,       ALL);
-IDA_GENERIC_FOP(rmdir,        ALL);
-IDA_GENERIC_FOP(setattr,      ALL);
-IDA_GENERIC_FOP(fsetattr,     ALL);
-IDA_GENERIC_FOP(setxattr,     ALL);
-IDA_GENERIC_FOP(fsetxattr,    ALL);
-IDA_GENERIC_FOP(stat,         INC);
-IDA_GENERIC_FOP(fstat,        INC);
-IDA_GENERIC_FOP(statfs,       ALL);
-IDA_GENERIC_FOP(symlink,      ALL);
-IDA_GENERIC_FOP(truncate,     ALL);
-IDA_GENERIC_FOP(ftruncate,    ALL);
-IDA_GENERIC_FOP(unlink,       ALL);
-IDA_GENERIC_FOP(writev,       MOD);
-IDA_GENERIC_FOP(xattrop,      ALL);
-IDA_GENERIC_FOP(fxattrop,     ALL);
+        .prepare     = SYS_GLUE(ida_prepare_, _fop), \
+        .dispatch    = SYS_GLUE(ida_dispatch_, IDA_FOP_DISPATCH_##_num), \
+        .completed   = SYS_GLUE(ida_completed_, _fop), \
+        .combine     = SYS_GLUE(ida_combine_, _fop), \
+        .rebuild     = SYS_GLUE(ida_rebuild_, _fop), \
+        .copy        = SYS_GLUE(ida_copy_, _fop), \
+        .fingerprint = SYS_GLUE(ida_fingerprint_, _fop), \
+    }
+
+IDA_GENERIC_FOP(access,       INC, none);
+IDA_GENERIC_FOP(create,       ALL, buf);
+IDA_GENERIC_FOP(entrylk,      ALL, none);
+IDA_GENERIC_FOP(fentrylk,     ALL, none);
+IDA_GENERIC_FOP(flush,        ALL, none);
+IDA_GENERIC_FOP(fsync,        ALL, postbuf);
+IDA_GENERIC_FOP(fsyncdir,     ALL, none);
+IDA_GENERIC_FOP(getxattr,     INC, none);
+IDA_GENERIC_FOP(fgetxattr,    INC, none);
+IDA_GENERIC_FOP(inodelk,      ALL, none);
+IDA_GENERIC_FOP(finodelk,     ALL, none);
+IDA_GENERIC_FOP(link,         ALL, buf);
+IDA_GENERIC_FOP(lk,           ALL, none);
+IDA_GENERIC_FOP(lookup,       ALL, buf);
+IDA_GENERIC_FOP(mkdir,        ALL, buf);
+IDA_GENERIC_FOP(mknod,        ALL, buf);
+IDA_GENERIC_FOP(open,         OPN, none);
+IDA_GENERIC_FOP(opendir,      ALL, none);
+IDA_GENERIC_FOP(rchecksum,    MIN, none);
+IDA_GENERIC_FOP(readdir,      INC, none);
+IDA_GENERIC_FOP(readdirp,     INC, none);
+IDA_GENERIC_FOP(readlink,     INC, buf);
+IDA_GENERIC_FOP(readv,        MIN, stbuf);
+IDA_GENERIC_FOP(removexattr,  ALL, none);
+IDA_GENERIC_FOP(fremovexattr, ALL, none);
+IDA_GENERIC_FOP(rename,       ALL, buf);
+IDA_GENERIC_FOP(rmdir,        ALL, postparent);
+IDA_GENERIC_FOP(setattr,      ALL, postop_stbuf);
+IDA_GENERIC_FOP(fsetattr,     ALL, postop_stbuf);
+IDA_GENERIC_FOP(setxattr,     ALL, none);
+IDA_GENERIC_FOP(fsetxattr,    ALL, none);
+IDA_GENERIC_FOP(stat,         INC, buf);
+IDA_GENERIC_FOP(fstat,        INC, buf);
+IDA_GENERIC_FOP(statfs,       ALL, none);
+IDA_GENERIC_FOP(symlink,      ALL, buf);
+IDA_GENERIC_FOP(truncate,     TRN, postbuf);
+IDA_GENERIC_FOP(ftruncate,    TRN, postbuf);
+IDA_GENERIC_FOP(unlink,       ALL, postparent);
+IDA_GENERIC_FOP(writev,       MOD, postbuf);
+IDA_GENERIC_FOP(xattrop,      ALL, none);
+IDA_GENERIC_FOP(fxattrop,     ALL, none);
 
@@ -62,6 +62,7 @@ bool ida_prepare_truncate(ida_private_t * ida, ida_request_t * req);
 bool ida_prepare_ftruncate(ida_private_t * ida, ida_request_t * req);
 bool ida_prepare_unlink(ida_private_t * ida, ida_request_t * req);
 bool ida_prepare_writev(ida_private_t * ida, ida_request_t * req);
+bool ida_prepare_writev_fragments(ida_private_t * ida, ida_request_t * req);
 bool ida_prepare_xattrop(ida_private_t * ida, ida_request_t * req);
 bool ida_prepare_fxattrop(ida_private_t * ida, ida_request_t * req);
 
@@ -194,6 +195,8 @@ int32_t ida_rebuild_readlink(ida_private_t * ida, ida_request_t * req,
                              ida_answer_t * data);
 int32_t ida_rebuild_readv(ida_private_t * ida, ida_request_t * req,
                           ida_answer_t * data);
+int32_t ida_rebuild_readv_fragments(ida_private_t * ida, ida_request_t * req,
+                                    ida_answer_t * data);
 int32_t ida_rebuild_removexattr(ida_private_t * ida, ida_request_t * req,
                                 ida_answer_t * data);
 int32_t ida_rebuild_fremovexattr(ida_private_t * ida, ida_request_t * req,
@@ -20,6 +20,8 @@
 
 #include "gfsys.h"
 
+#include <time.h>
+
 #include "ida-common.h"
 #include "ida.h"
 
@@ -145,3 +147,106 @@ int32_t ida_xattr_merge(ida_local_t * local, dict_t ** dst, dict_t * src)
 
     return (dict_foreach(src, ida_xattr_merge_add, &data) < 0) ? EIO : 0;
 }
+
+void ida_iov_cursor_init(ida_iov_cursor_t * cursor, struct iovec * iovec,
+                         int32_t count, size_t offset)
+{
+    cursor->iovec = iovec;
+    cursor->count = count;
+    cursor->index = 0;
+    while ((cursor->index < count) &&
+           (offset >= iovec[cursor->index].iov_len))
+    {
+        offset -= iovec[cursor->index].iov_len;
+        cursor->index++;
+    }
+    cursor->offset = offset;
+}
+
+// Returns the number of contiguous bytes available at the current position,
+// or 0 if they cannot be used directly by the coding functions because they
+// are not properly aligned.
+size_t ida_iov_cursor_contiguous(ida_iov_cursor_t * cursor, uint8_t ** ptr)
+{
+    if (cursor->index >= cursor->count)
+    {
+        return 0;
+    }
+
+    *ptr = (uint8_t *)cursor->iovec[cursor->index].iov_base + cursor->offset;
+    if (((uintptr_t)*ptr & 15) != 0)
+    {
+        return 0;
+    }
+
+    return cursor->iovec[cursor->index].iov_len - cursor->offset;
+}
+
+// Advances the cursor 'size' bytes, copying them to 'dst' if not NULL.
+void ida_iov_cursor_advance(ida_iov_cursor_t * cursor, uint8_t * dst,
+                            size_t size)
+{
+    size_t length;
+
+    while (size > 0)
+    {
+        length = cursor->iovec[cursor->index].iov_len - cursor->offset;
+        if (length > size)
+        {
+            length = size;
+        }
+        if (dst != NULL)
+        {
+            memcpy(dst, (uint8_t *)cursor->iovec[cursor->index].iov_base +
+                        cursor->offset, length);
+            dst += length;
+        }
+        size -= length;
+        cursor->offset += length;
+        if (cursor->offset == cursor->iovec[cursor->index].iov_len)
+        {
+            cursor->index++;
+            cursor->offset = 0;
+        }
+    }
+}
+
+// FNV-1a hash of a buffer. 'hash' is IDA_HASH_INIT or the result of a
+// previous call, to hash several buffers as a single one.
+uint64_t ida_hash_buffer(uint64_t hash, const void * data, size_t size)
+{
+    const uint8_t * ptr;
+
+    ptr = data;
+    while (size-- > 0)
+    {
+        hash = (hash ^ *ptr++) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Monotonic time in microseconds.
+uint64_t ida_time_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+static uint32_t ida_thread_next = 0;
+static __thread uint32_t ida_thread_id = 0;
+
+// Small number that identifies the calling thread. It's assigned the first
+// time a thread calls this function and never changes.
+uint32_t ida_thread_index(void)
+{
+    if (ida_thread_id == 0)
+    {
+        ida_thread_id = atomic_inc(&ida_thread_next, memory_order_relaxed) + 1;
+    }
+
+    return ida_thread_id - 1;
+}
@@ -25,6 +25,19 @@
 
 #include "ida-manager.h"
 
+// Amount of data of each fragment copied at once when a group cannot be
+// decoded directly from the buffers received from the bricks.
+#define IDA_BOUNCE_SIZE (8 * IDA_GF_BITS * 16)
+
+// Position inside an array of iovecs.
+typedef struct
+{
+    struct iovec * iovec;
+    int32_t        count;
+    int32_t        index;
+    size_t         offset;
+} ida_iov_cursor_t;
+
 off_t ida_offset_adjust(ida_local_t * local, off_t offset);
 size_t ida_size_adjust(ida_local_t * local, size_t size);
 void ida_offset_size_adjust(ida_local_t * loca, off_t * offset, size_t * size);
@@ -34,4 +47,17 @@ int32_t ida_xattr_update_content(ida_local_t * local, dict_t * dict, size_t * ol
 int32_t ida_xattr_copy(ida_local_t * local, dict_t ** dst, dict_t * src);
 int32_t ida_xattr_merge(ida_local_t * local, dict_t ** dst, dict_t * src);
 
+void ida_iov_cursor_init(ida_iov_cursor_t * cursor, struct iovec * iovec,
+                         int32_t count, size_t offset);
+size_t ida_iov_cursor_contiguous(ida_iov_cursor_t * cursor, uint8_t ** ptr);
+void ida_iov_cursor_advance(ida_iov_cursor_t * cursor, uint8_t * dst,
+                            size_t size);
+
+#define IDA_HASH_INIT 0xcbf29ce484222325ULL
+
+uint64_t ida_hash_buffer(uint64_t hash, const void * data, size_t size);
+
+uint64_t ida_time_now(void);
+uint32_t ida_thread_index(void);
+
 #endif /* __IDA_COMMON_H__ */
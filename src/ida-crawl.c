@@ -0,0 +1,937 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include <endian.h>
+
+#include "statedump.h"
+
+#include "ida-common.h"
+#include "ida-mem-types.h"
+#include "ida-manager.h"
+#include "ida-combine.h"
+#include "ida-crawl.h"
+#include "ida.h"
+
+// Number of inodes of the crawler's table kept when unused.
+#define IDA_CRAWL_INODES 4096
+
+// Size requested to each readdirp.
+#define IDA_CRAWL_READDIR_SIZE 65536
+
+// Milliseconds to wait before checking again if the number of heals has
+// dropped below the limit.
+#define IDA_CRAWL_WAIT 100
+
+// Minimum number of microseconds between two updates of the stored position.
+#define IDA_CRAWL_SAVE_TIME 1000000
+
+// Position of a directory of the current path, as stored in IDA_KEY_CRAWL.
+// 'mask' contains the subvolumes that were being read, since offsets are only
+// valid for them.
+typedef struct
+{
+    uint8_t  gfid[16];
+    uint64_t offset;
+    uint64_t mask;
+} __attribute__((packed)) ida_crawl_pos_t;
+
+static uuid_t ida_crawl_root_gfid =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+};
+
+SYS_ASYNC_DECLARE(ida_crawl_next, ((ida_crawl_t *, crawl)));
+
+#define IDA_CRAWL_FOP(_fop, _dispatch, _done) \
+    static void _done(ida_crawl_t * crawl, ida_request_t * req, \
+                      SYS_GF_CBK_CALL_TYPE(_fop) * args); \
+    static void ida_crawl_##_fop##_completed(call_frame_t * frame, \
+                                             err_t error, \
+                                             ida_request_t * req, \
+                                             uintptr_t * data) \
+    { \
+        SYS_GF_CBK_CALL_TYPE(_fop) * args; \
+        args = NULL; \
+        if ((error == 0) && (data != NULL)) \
+        { \
+            args = (SYS_GF_CBK_CALL_TYPE(_fop) *)data; \
+            if (args->op_ret < 0) \
+            { \
+                args = NULL; \
+            } \
+        } \
+        _done(frame->local, req, args); \
+    } \
+    static ida_handlers_t ida_crawl_##_fop##_handlers = \
+    { \
+        .prepare     = ida_prepare_##_fop, \
+        .dispatch    = _dispatch, \
+        .completed   = ida_crawl_##_fop##_completed, \
+        .combine     = ida_combine_##_fop, \
+        .rebuild     = ida_rebuild_##_fop, \
+        .copy        = ida_copy_##_fop, \
+        .fingerprint = ida_fingerprint_##_fop \
+    }
+
+IDA_CRAWL_FOP(getxattr, ida_dispatch_incremental, ida_crawl_loaded);
+IDA_CRAWL_FOP(setxattr, ida_dispatch_all, ida_crawl_saved);
+IDA_CRAWL_FOP(removexattr, ida_dispatch_all, ida_crawl_finished);
+IDA_CRAWL_FOP(lookup, ida_dispatch_all, ida_crawl_checked);
+IDA_CRAWL_FOP(opendir, ida_dispatch_all, ida_crawl_opened);
+IDA_CRAWL_FOP(readdirp, ida_dispatch_incremental, ida_crawl_read);
+
+SYS_DELAY_CREATE(ida_crawl_timeout, ((ida_crawl_t *, crawl)))
+{
+    bool stopped;
+
+    pthread_mutex_lock(&crawl->lock);
+
+    if (crawl->delay != NULL)
+    {
+        sys_delay_release(crawl->delay);
+        crawl->delay = NULL;
+    }
+    stopped = crawl->stopped;
+    if (stopped)
+    {
+        crawl->active = false;
+        pthread_cond_broadcast(&crawl->cond);
+    }
+
+    pthread_mutex_unlock(&crawl->lock);
+
+    if (!stopped)
+    {
+        ida_crawl_next(crawl);
+    }
+}
+
+// Ends the current sequence of requests. The crawler must not be accessed
+// after this call, since it could be released.
+static void ida_crawl_stop(ida_crawl_t * crawl)
+{
+    pthread_mutex_lock(&crawl->lock);
+
+    crawl->active = false;
+    pthread_cond_broadcast(&crawl->cond);
+
+    pthread_mutex_unlock(&crawl->lock);
+}
+
+// The crawl is continued after 'time' milliseconds.
+static void ida_crawl_wait(ida_crawl_t * crawl, int32_t time)
+{
+    pthread_mutex_lock(&crawl->lock);
+
+    if (!crawl->stopped)
+    {
+        crawl->delay = SYS_DELAY(time, ida_crawl_timeout, (crawl), 1);
+        if (crawl->delay == NULL)
+        {
+            logE("Unable to schedule the heal crawler. It will be resumed "
+                 "when the volume goes up again.");
+        }
+    }
+    if (crawl->delay == NULL)
+    {
+        crawl->active = false;
+        pthread_cond_broadcast(&crawl->cond);
+    }
+
+    pthread_mutex_unlock(&crawl->lock);
+}
+
+static err_t ida_crawl_loc(ida_crawl_t * crawl, loc_t * loc, loc_t * parent,
+                           const char * name, uuid_t gfid)
+{
+    char * path;
+
+    memset(loc, 0, sizeof(loc_t));
+
+    if (uuid_compare(gfid, ida_crawl_root_gfid) == 0)
+    {
+        path = gf_strdup("/");
+    }
+    else if (parent == NULL)
+    {
+        gf_asprintf(&path, "<gfid:%s>", uuid_utoa(gfid));
+    }
+    else if (strcmp(parent->path, "/") == 0)
+    {
+        gf_asprintf(&path, "/%s", name);
+    }
+    else
+    {
+        gf_asprintf(&path, "%s/%s", parent->path, name);
+    }
+    if (path == NULL)
+    {
+        return ENOMEM;
+    }
+
+    loc->path = path;
+    uuid_copy(loc->gfid, gfid);
+    if (uuid_compare(gfid, ida_crawl_root_gfid) == 0)
+    {
+        loc->inode = inode_ref(crawl->itable->root);
+    }
+    else
+    {
+        loc->inode = inode_new(crawl->itable);
+    }
+    if (parent != NULL)
+    {
+        loc->name = strrchr(path, '/') + 1;
+        loc->parent = inode_ref(parent->inode);
+        uuid_copy(loc->pargfid, parent->inode->gfid);
+    }
+    if (loc->inode == NULL)
+    {
+        loc_wipe(loc);
+
+        return ENOMEM;
+    }
+
+    return 0;
+}
+
+// Replaces the inode of 'loc' by the one linked into the inode table.
+static void ida_crawl_link(loc_t * loc, struct iatt * buf)
+{
+    inode_t * inode;
+
+    inode = inode_link(loc->inode, loc->parent, loc->name, buf);
+    if (inode != NULL)
+    {
+        inode_unref(loc->inode);
+        loc->inode = inode;
+    }
+}
+
+static void ida_crawl_entries_release(ida_crawl_t * crawl)
+{
+    gf_dirent_free(&crawl->entries);
+    crawl->entry = NULL;
+}
+
+static void ida_crawl_push(ida_crawl_t * crawl, loc_t * loc, uint64_t offset,
+                           uint64_t mask, bool resolved)
+{
+    ida_crawl_level_t * level;
+
+    level = &crawl->levels[crawl->depth++];
+    memcpy(&level->loc, loc, sizeof(loc_t));
+    memset(loc, 0, sizeof(loc_t));
+    level->fd = NULL;
+    level->offset = offset;
+    level->mask = mask;
+    level->resolved = resolved;
+    level->retried = false;
+}
+
+// Once a directory has been completely crawled, its parent continues after
+// the entry that was being checked.
+static void ida_crawl_pop(ida_crawl_t * crawl)
+{
+    ida_crawl_level_t * level;
+
+    ida_crawl_entries_release(crawl);
+
+    level = &crawl->levels[--crawl->depth];
+    if (level->fd != NULL)
+    {
+        fd_unref(level->fd);
+        level->fd = NULL;
+    }
+    loc_wipe(&level->loc);
+}
+
+static void ida_crawl_reset(ida_crawl_t * crawl)
+{
+    while (crawl->depth > 0)
+    {
+        ida_crawl_pop(crawl);
+    }
+    loc_wipe(&crawl->check);
+    crawl->loaded = false;
+}
+
+// The stored position is loaded each time a crawl is started. If there is
+// none, the crawl starts from the root directory.
+static void ida_crawl_load(ida_crawl_t * crawl)
+{
+    ida_private_t * ida;
+
+    ida = crawl->xl->private;
+
+    loc_wipe(&crawl->root);
+    SYS_CALL(
+        ida_crawl_loc, (crawl, &crawl->root, NULL, NULL, ida_crawl_root_gfid),
+        E(),
+        GOTO(failed)
+    );
+
+    SYS_ASYNC(
+        ida_getxattr, (crawl->frame, crawl->xl, &ida_crawl_getxattr_handlers,
+                       IDA_SKIP_DFC, ida_get_bad(crawl->xl, &crawl->root,
+                                                 NULL, NULL),
+                       ida->fragments, 1, &crawl->root, NULL, NULL,
+                       &crawl->root, IDA_KEY_CRAWL, NULL)
+    );
+
+    return;
+
+failed:
+    ida_crawl_stop(crawl);
+}
+
+static void ida_crawl_loaded(ida_crawl_t * crawl, ida_request_t * req,
+                             SYS_GF_CBK_CALL_TYPE(getxattr) * args)
+{
+    ida_crawl_pos_t pos;
+    data_t * data;
+    loc_t loc;
+    uint32_t i, count;
+
+    count = 0;
+    data = NULL;
+    if ((args != NULL) && (args->dict != NULL))
+    {
+        data = dict_get(args->dict, IDA_KEY_CRAWL);
+    }
+    if ((data != NULL) && (data->len % sizeof(ida_crawl_pos_t) == 0))
+    {
+        count = data->len / sizeof(ida_crawl_pos_t);
+        if (count > IDA_CRAWL_MAX_DEPTH)
+        {
+            count = 0;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        memcpy(&pos, data->data + i * sizeof(ida_crawl_pos_t), sizeof(pos));
+        if ((i == 0) && (uuid_compare(pos.gfid, ida_crawl_root_gfid) != 0))
+        {
+            break;
+        }
+        SYS_CALL(
+            ida_crawl_loc, (crawl, &loc, NULL, NULL, pos.gfid),
+            E(),
+            GOTO(failed)
+        );
+        ida_crawl_push(crawl, &loc, be64toh(pos.offset), be64toh(pos.mask),
+                       i == 0);
+    }
+
+    if (crawl->depth > 0)
+    {
+        logI("Resuming heal crawl at depth %d", crawl->depth);
+    }
+    else
+    {
+        logI("Starting heal crawl");
+        SYS_CALL(
+            ida_crawl_loc, (crawl, &loc, NULL, NULL, ida_crawl_root_gfid),
+            E(),
+            GOTO(failed)
+        );
+        ida_crawl_push(crawl, &loc, 0, 0, true);
+    }
+
+    crawl->loaded = true;
+    crawl->saved = ida_time_now();
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+
+    return;
+
+failed:
+    ida_crawl_reset(crawl);
+    ida_crawl_stop(crawl);
+}
+
+static void ida_crawl_save(ida_crawl_t * crawl)
+{
+    ida_private_t * ida;
+    ida_crawl_level_t * level;
+    ida_crawl_pos_t * pos;
+    dict_t * dict;
+    data_t * data;
+    int32_t i;
+
+    ida = crawl->xl->private;
+
+    crawl->saved = ida_time_now();
+
+    pos = GF_CALLOC(crawl->depth, sizeof(ida_crawl_pos_t), ida_mt_uint8_t);
+    if (pos == NULL)
+    {
+        goto failed;
+    }
+    for (i = 0; i < crawl->depth; i++)
+    {
+        level = &crawl->levels[i];
+        memcpy(pos[i].gfid, level->loc.gfid, sizeof(pos[i].gfid));
+        pos[i].offset = htobe64(level->offset);
+        pos[i].mask = htobe64(level->mask);
+    }
+    data = data_from_dynptr(pos, crawl->depth * sizeof(ida_crawl_pos_t));
+    if (data == NULL)
+    {
+        GF_FREE(pos);
+
+        goto failed;
+    }
+
+    dict = NULL;
+    SYS_CALL(
+        sys_dict_set, (&dict, IDA_KEY_CRAWL, data, NULL),
+        E(),
+        GOTO(failed_data)
+    );
+
+    SYS_ASYNC(
+        ida_setxattr, (crawl->frame, crawl->xl, &ida_crawl_setxattr_handlers,
+                       IDA_USE_DFC, ida_get_bad(crawl->xl, &crawl->root,
+                                                NULL, NULL),
+                       ida->fragments, ida->fragments, &crawl->root, NULL,
+                       NULL, &crawl->root, dict, 0, NULL)
+    );
+
+    sys_dict_release(dict);
+
+    return;
+
+failed_data:
+    data_unref(data);
+failed:
+    logW("Unable to save the position of the heal crawler");
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+static void ida_crawl_saved(ida_crawl_t * crawl, ida_request_t * req,
+                            SYS_GF_CBK_CALL_TYPE(setxattr) * args)
+{
+    if (args == NULL)
+    {
+        logW("Unable to save the position of the heal crawler");
+    }
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+// The whole volume has been crawled. The stored position is removed and the
+// next crawl is started after 'heal-crawl-interval' seconds.
+static void ida_crawl_finish(ida_crawl_t * crawl)
+{
+    ida_private_t * ida;
+
+    ida = crawl->xl->private;
+
+    SYS_ASYNC(
+        ida_removexattr, (crawl->frame, crawl->xl,
+                          &ida_crawl_removexattr_handlers, IDA_USE_DFC,
+                          ida_get_bad(crawl->xl, &crawl->root, NULL, NULL),
+                          ida->fragments, ida->fragments, &crawl->root, NULL,
+                          NULL, &crawl->root, IDA_KEY_CRAWL, NULL)
+    );
+}
+
+static void ida_crawl_finished(ida_crawl_t * crawl, ida_request_t * req,
+                               SYS_GF_CBK_CALL_TYPE(removexattr) * args)
+{
+    ida_private_t * ida;
+
+    ida = crawl->xl->private;
+
+    logI("Heal crawl finished");
+    ida_stats_add(&ida->stats, IDA_STATS_CRAWLS_FINISHED, 1);
+
+    crawl->loaded = false;
+
+    crawl->frame->local = NULL;
+    STACK_RESET(crawl->frame->root);
+    crawl->frame->local = crawl;
+
+    ida_crawl_wait(crawl, ida->crawl_interval * 1000);
+}
+
+// Directories restored from the stored position are looked up by gfid.
+static void ida_crawl_resolve(ida_crawl_t * crawl, ida_crawl_level_t * level)
+{
+    ida_private_t * ida;
+
+    ida = crawl->xl->private;
+
+    SYS_ASYNC(
+        ida_lookup, (crawl->frame, crawl->xl, &ida_crawl_lookup_handlers,
+                     IDA_USE_DFC, ida_get_bad(crawl->xl, &level->loc, NULL,
+                                              NULL),
+                     ida->fragments, ida->fragments, &level->loc, NULL, NULL,
+                     &level->loc, NULL)
+    );
+}
+
+static void ida_crawl_open(ida_crawl_t * crawl, ida_crawl_level_t * level)
+{
+    ida_private_t * ida;
+    ida_fd_ctx_t * fd_ctx;
+    uint64_t value;
+    fd_t * fd;
+
+    ida = crawl->xl->private;
+
+    SYS_PTR(
+        &fd, fd_create, (level->loc.inode, crawl->frame->root->pid),
+        ENOMEM,
+        E(),
+        GOTO(failed)
+    );
+    SYS_CALL(
+        ida_fd_ctx_create, (fd, crawl->xl, &level->loc),
+        E(),
+        GOTO(failed_fd)
+    );
+
+    // Offsets are only valid for the subvolumes they were read from.
+    if ((fd_ctx_get(fd, crawl->xl, &value) == 0) && (value != 0))
+    {
+        fd_ctx = (ida_fd_ctx_t *)(uintptr_t)value;
+        fd_ctx->data = level->mask;
+    }
+
+    SYS_ASYNC(
+        ida_opendir, (crawl->frame, crawl->xl, &ida_crawl_opendir_handlers,
+                      IDA_USE_DFC, ida_get_bad(crawl->xl, &level->loc, NULL,
+                                               fd),
+                      ida->fragments, ida->nodes, &level->loc, NULL, fd,
+                      &level->loc, fd, NULL)
+    );
+
+    fd_unref(fd);
+
+    return;
+
+failed_fd:
+    fd_unref(fd);
+failed:
+    logW("Unable to open directory %s", level->loc.path);
+
+    ida_crawl_pop(crawl);
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+static void ida_crawl_opened(ida_crawl_t * crawl, ida_request_t * req,
+                             SYS_GF_CBK_CALL_TYPE(opendir) * args)
+{
+    ida_crawl_level_t * level;
+
+    level = &crawl->levels[crawl->depth - 1];
+    if (args == NULL)
+    {
+        logW("Unable to open directory %s", level->loc.path);
+
+        ida_crawl_pop(crawl);
+    }
+    else
+    {
+        level->fd = fd_ref(req->fd);
+    }
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+static void ida_crawl_readdirp(ida_crawl_t * crawl, ida_crawl_level_t * level)
+{
+    ida_private_t * ida;
+
+    ida = crawl->xl->private;
+
+    SYS_ASYNC(
+        ida_readdirp, (crawl->frame, crawl->xl, &ida_crawl_readdirp_handlers,
+                       IDA_SKIP_DFC, ida_get_bad(crawl->xl, NULL, NULL,
+                                                 level->fd),
+                       ida->fragments, 1, NULL, NULL, level->fd, level->fd,
+                       IDA_CRAWL_READDIR_SIZE, level->offset, NULL)
+    );
+}
+
+static void ida_crawl_read(ida_crawl_t * crawl, ida_request_t * req,
+                           SYS_GF_CBK_CALL_TYPE(readdirp) * args)
+{
+    ida_crawl_level_t * level;
+    ida_fd_ctx_t * fd_ctx;
+    uint64_t value;
+
+    level = &crawl->levels[crawl->depth - 1];
+    if (args == NULL)
+    {
+        // The stored offset could belong to subvolumes that are not
+        // available anymore. The directory is read again from the start.
+        if ((level->offset != 0) && !level->retried)
+        {
+            logW("Unable to read directory %s at offset %" PRIu64 ", "
+                 "restarting it", level->loc.path, level->offset);
+
+            level->retried = true;
+            level->offset = 0;
+            level->mask = 0;
+            fd_unref(level->fd);
+            level->fd = NULL;
+        }
+        else
+        {
+            logW("Unable to read directory %s", level->loc.path);
+
+            ida_crawl_pop(crawl);
+        }
+    }
+    else if (args->op_ret == 0)
+    {
+        ida_crawl_pop(crawl);
+    }
+    else
+    {
+        if ((fd_ctx_get(req->fd, crawl->xl, &value) == 0) && (value != 0))
+        {
+            fd_ctx = (ida_fd_ctx_t *)(uintptr_t)value;
+            level->mask = fd_ctx->data;
+        }
+        list_splice_init(&args->entries.list, &crawl->entries.list);
+        crawl->entry = list_entry(crawl->entries.list.next, gf_dirent_t,
+                                  list);
+    }
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+// Each entry is looked up on all subvolumes. Any difference between them
+// starts a heal of the entry, as for any other request.
+static void ida_crawl_check(ida_crawl_t * crawl, ida_crawl_level_t * level)
+{
+    ida_private_t * ida;
+    gf_dirent_t * entry;
+
+    ida = crawl->xl->private;
+
+    entry = crawl->entry;
+    while ((strcmp(entry->d_name, ".") == 0) ||
+           (strcmp(entry->d_name, "..") == 0))
+    {
+        level->offset = entry->d_off;
+        if (entry->list.next == &crawl->entries.list)
+        {
+            ida_crawl_entries_release(crawl);
+            SYS_ASYNC(ida_crawl_next, (crawl));
+
+            return;
+        }
+        entry = list_entry(entry->list.next, gf_dirent_t, list);
+    }
+    crawl->entry = entry;
+
+    // Heals started by the crawler are bounded by waiting until there
+    // are fewer heals in progress than 'heal-crawl-heals'.
+    if (__atomic_load_n(&ida->healing, __ATOMIC_ACQUIRE) >= ida->crawl_heals)
+    {
+        ida_crawl_wait(crawl, IDA_CRAWL_WAIT);
+
+        return;
+    }
+
+    SYS_CALL(
+        ida_crawl_loc, (crawl, &crawl->check, &level->loc, entry->d_name,
+                        entry->d_stat.ia_gfid),
+        E(),
+        GOTO(failed)
+    );
+
+    SYS_ASYNC(
+        ida_lookup, (crawl->frame, crawl->xl, &ida_crawl_lookup_handlers,
+                     IDA_USE_DFC, ida_get_bad(crawl->xl, &crawl->check, NULL,
+                                              NULL),
+                     ida->fragments, ida->fragments, &crawl->check, NULL,
+                     NULL, &crawl->check, NULL)
+    );
+
+    return;
+
+failed:
+    ida_crawl_reset(crawl);
+    ida_crawl_stop(crawl);
+}
+
+static void ida_crawl_checked(ida_crawl_t * crawl, ida_request_t * req,
+                              SYS_GF_CBK_CALL_TYPE(lookup) * args)
+{
+    ida_private_t * ida;
+    ida_crawl_level_t * level;
+    gf_dirent_t * entry;
+
+    ida = crawl->xl->private;
+
+    level = &crawl->levels[crawl->depth - 1];
+
+    // A directory restored from the stored position has been resolved.
+    if (!level->resolved)
+    {
+        if ((args == NULL) || (args->buf.ia_type != IA_IFDIR))
+        {
+            logW("Directory %s not found", level->loc.path);
+
+            ida_crawl_pop(crawl);
+        }
+        else
+        {
+            ida_crawl_link(&level->loc, &args->buf);
+            level->resolved = true;
+        }
+
+        SYS_ASYNC(ida_crawl_next, (crawl));
+
+        return;
+    }
+
+    ida_stats_add(&ida->stats, IDA_STATS_CRAWL_ENTRIES, 1);
+
+    entry = crawl->entry;
+    level->offset = entry->d_off;
+    if (entry->list.next == &crawl->entries.list)
+    {
+        ida_crawl_entries_release(crawl);
+    }
+    else
+    {
+        crawl->entry = list_entry(entry->list.next, gf_dirent_t, list);
+    }
+
+    if ((args != NULL) && (args->buf.ia_type == IA_IFDIR))
+    {
+        if (crawl->depth < IDA_CRAWL_MAX_DEPTH)
+        {
+            // The remaining entries will be read again once the crawl comes
+            // back to this directory.
+            ida_crawl_entries_release(crawl);
+            ida_crawl_link(&crawl->check, &args->buf);
+            ida_crawl_push(crawl, &crawl->check, 0, 0, true);
+        }
+        else
+        {
+            logW("Directory %s is too deep to be crawled",
+                 crawl->check.path);
+        }
+    }
+    loc_wipe(&crawl->check);
+
+    SYS_ASYNC(ida_crawl_next, (crawl));
+}
+
+SYS_ASYNC_DEFINE(ida_crawl_next, ((ida_crawl_t *, crawl)))
+{
+    ida_private_t * ida;
+    ida_crawl_level_t * level;
+
+    ida = crawl->xl->private;
+
+    // The crawl is restarted from the stored position when the volume goes
+    // up again.
+    if (crawl->stopped || !ida->up)
+    {
+        ida_crawl_reset(crawl);
+        ida_crawl_stop(crawl);
+
+        return;
+    }
+
+    if (!crawl->loaded)
+    {
+        ida_crawl_load(crawl);
+
+        return;
+    }
+    if (crawl->depth == 0)
+    {
+        ida_crawl_finish(crawl);
+
+        return;
+    }
+
+    level = &crawl->levels[crawl->depth - 1];
+    if (!level->resolved)
+    {
+        ida_crawl_resolve(crawl, level);
+    }
+    else if (level->fd == NULL)
+    {
+        ida_crawl_open(crawl, level);
+    }
+    else if (crawl->entry != NULL)
+    {
+        ida_crawl_check(crawl, level);
+    }
+    else if (ida_time_now() - crawl->saved >= IDA_CRAWL_SAVE_TIME)
+    {
+        ida_crawl_save(crawl);
+    }
+    else
+    {
+        ida_crawl_readdirp(crawl, level);
+    }
+}
+
+err_t ida_crawl_initialize(ida_crawl_t * crawl, xlator_t * xl)
+{
+    ida_private_t * ida;
+
+    memset(crawl, 0, sizeof(ida_crawl_t));
+    crawl->xl = xl;
+    pthread_mutex_init(&crawl->lock, NULL);
+    pthread_cond_init(&crawl->cond, NULL);
+    INIT_LIST_HEAD(&crawl->entries.list);
+
+    ida = xl->private;
+    if (ida->crawl_interval == 0)
+    {
+        return 0;
+    }
+
+    // The crawler keeps its own inodes, since it doesn't receive them from
+    // the upper translators.
+    SYS_PTR(
+        &crawl->itable, inode_table_new, (IDA_CRAWL_INODES, xl),
+        ENOMEM,
+        E(),
+        RETERR()
+    );
+
+    return 0;
+}
+
+// Waits until the pending request or delay, if any, has seen that the
+// crawler is stopped before releasing it.
+void ida_crawl_terminate(ida_crawl_t * crawl)
+{
+    uintptr_t * delay;
+
+    if (crawl->xl == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&crawl->lock);
+
+    crawl->stopped = true;
+    delay = crawl->delay;
+    crawl->delay = NULL;
+
+    pthread_mutex_unlock(&crawl->lock);
+
+    // The delayed callback is executed right now. It will see that the
+    // crawler is stopped.
+    if (delay != NULL)
+    {
+        sys_delay_execute(delay, 0);
+    }
+
+    pthread_mutex_lock(&crawl->lock);
+    while (crawl->active)
+    {
+        pthread_cond_wait(&crawl->cond, &crawl->lock);
+    }
+    pthread_mutex_unlock(&crawl->lock);
+
+    ida_crawl_reset(crawl);
+    loc_wipe(&crawl->root);
+    if (crawl->frame != NULL)
+    {
+        crawl->frame->local = NULL;
+        STACK_DESTROY(crawl->frame->root);
+        crawl->frame = NULL;
+    }
+    if (crawl->itable != NULL)
+    {
+        inode_table_destroy(crawl->itable);
+        crawl->itable = NULL;
+    }
+
+    pthread_cond_destroy(&crawl->cond);
+    pthread_mutex_destroy(&crawl->lock);
+    crawl->xl = NULL;
+}
+
+// Starts or resumes the crawl if it's enabled and it isn't already running
+// or waiting.
+void ida_crawl_start(ida_crawl_t * crawl)
+{
+    bool start;
+
+    if (crawl->itable == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&crawl->lock);
+
+    start = !crawl->active && !crawl->stopped;
+    if (start && (crawl->frame == NULL))
+    {
+        crawl->frame = create_frame(crawl->xl, crawl->xl->ctx->pool);
+        if (crawl->frame == NULL)
+        {
+            logE("Unable to start the heal crawler");
+
+            start = false;
+        }
+        else
+        {
+            crawl->frame->local = crawl;
+        }
+    }
+    crawl->active = start;
+
+    pthread_mutex_unlock(&crawl->lock);
+
+    if (start)
+    {
+        SYS_ASYNC(ida_crawl_next, (crawl));
+    }
+}
+
+void ida_crawl_dump(ida_crawl_t * crawl)
+{
+    if (crawl->itable == NULL)
+    {
+        return;
+    }
+
+    gf_proc_dump_write("crawl.active", "%d", crawl->active);
+    gf_proc_dump_write("crawl.depth", "%d", crawl->depth);
+    if (crawl->depth > 0)
+    {
+        gf_proc_dump_write("crawl.directory", "%s",
+                           crawl->levels[crawl->depth - 1].loc.path);
+        gf_proc_dump_write("crawl.offset", "%" PRIu64,
+                           crawl->levels[crawl->depth - 1].offset);
+    }
+}
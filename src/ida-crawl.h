@@ -0,0 +1,72 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_CRAWL_H__
+#define __IDA_CRAWL_H__
+
+#include <pthread.h>
+
+#include "xlator.h"
+#include "gf-dirent.h"
+
+// Deeper directories are not crawled.
+#define IDA_CRAWL_MAX_DEPTH 64
+
+typedef struct
+{
+    loc_t    loc;
+    fd_t *   fd;
+    uint64_t offset;
+    uint64_t mask;
+    bool     resolved;
+    bool     retried;
+} ida_crawl_level_t;
+
+// The crawler walks the volume depth first, one request at a time. The
+// position of each directory of the current path is stored in the root
+// directory from time to time, so that the crawl can be resumed after a
+// restart. 'active' is true while a request or a delay of the crawler is
+// pending. The crawler can only be released once it's false.
+typedef struct
+{
+    xlator_t *        xl;
+    inode_table_t *   itable;
+    call_frame_t *    frame;
+    pthread_mutex_t   lock;
+    pthread_cond_t    cond;
+    uintptr_t *       delay;
+    bool              active;
+    bool              stopped;
+    bool              loaded;
+    uint64_t          saved;
+    loc_t             root;
+    loc_t             check;
+    gf_dirent_t       entries;
+    gf_dirent_t *     entry;
+    int32_t           depth;
+    ida_crawl_level_t levels[IDA_CRAWL_MAX_DEPTH];
+} ida_crawl_t;
+
+err_t ida_crawl_initialize(ida_crawl_t * crawl, xlator_t * xl);
+void ida_crawl_terminate(ida_crawl_t * crawl);
+void ida_crawl_start(ida_crawl_t * crawl);
+void ida_crawl_dump(ida_crawl_t * crawl);
+
+#endif /* __IDA_CRAWL_H__ */
@@ -0,0 +1,756 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include <arpa/inet.h>
+
+#include "ida-mem-types.h"
+#include "ida-pool.h"
+#include "ida-manager.h"
+#include "ida-combine.h"
+#include "ida-dirty.h"
+#include "ida.h"
+
+
+// Each inode keeps in IDA_KEY_DIRTY one counter per slot. Regions of
+// 'dirty_size' bytes are assigned to slots in a round robin way. A counter is
+// incremented on the subvolumes that will receive a modification before it's
+// sent, and decremented again only if all modifications of the slot have
+// succeeded on all subvolumes. So any subvolume that misses or fails a
+// modification leaves it recorded, and the heal subtracts the values it has
+// seen once the damaged subvolumes have been healed. Counters can only
+// overestimate the modified regions, never miss them.
+//
+// The increment of a slot is shared by all modifications sent while it's
+// present, and it's only removed once the slot has been idle for
+// IDA_DIRTY_LINGER milliseconds, so a sequence of writes only pays for the
+// first one. A request that needs a new increment, and all requests received
+// after it on the same inode, wait until it has been recorded. They are then
+// dispatched in arrival order.
+#define IDA_DIRTY_LINGER 1000
+
+typedef struct
+{
+    gf_lock_t        lock;
+    // Number of pending modifications of each slot.
+    int32_t          held[IDA_DIRTY_SLOTS];
+    // Slots with some pending modification.
+    uint64_t         busy;
+    // Busy slots whose increment must not be removed because some of their
+    // modifications have not succeeded on all subvolumes.
+    uint64_t         keep;
+    // Slots whose increment will be removed when 'delay' expires.
+    uint64_t         idle;
+    // Subvolumes that have recorded the increments of busy and idle slots.
+    uintptr_t        marked;
+    uintptr_t *      delay;
+    bool             marking;
+    struct list_head waiting;
+} ida_dirty_inode_t;
+
+typedef struct
+{
+    struct list_head     list;
+    ida_dirty_inode_t *  state;
+    ida_request_t *      req;
+    ida_dirty_dispatch_f dispatch;
+    uint64_t             need;
+} ida_dirty_mark_t;
+
+static void ida_dirty_completed(call_frame_t * frame, err_t error,
+                                ida_request_t * req, uintptr_t * data);
+
+// Marks not removed because of an error are harmless. They only cause a
+// region to be healed without need.
+static void ida_dirty_unmarked(call_frame_t * frame, err_t error,
+                               ida_request_t * req, uintptr_t * data)
+{
+    SYS_GF_CBK_CALL_TYPE(xattrop) * args;
+
+    args = (SYS_GF_CBK_CALL_TYPE(xattrop) *)data;
+    if ((error != 0) || (args == NULL) || (args->op_ret < 0))
+    {
+        logW("Unable to remove the record of modified regions (error %d).",
+             error);
+    }
+
+    STACK_DESTROY(frame->root);
+}
+
+static ida_handlers_t ida_dirty_handlers_xattrop =
+{
+    .prepare     = ida_prepare_xattrop,
+    .dispatch    = ida_dispatch_all,
+    .completed   = ida_dirty_completed,
+    .combine     = ida_combine_xattrop,
+    .rebuild     = ida_rebuild_xattrop,
+    .copy        = ida_copy_xattrop,
+    .fingerprint = ida_fingerprint_xattrop
+};
+
+static ida_handlers_t ida_dirty_handlers_fxattrop =
+{
+    .prepare     = ida_prepare_fxattrop,
+    .dispatch    = ida_dispatch_all,
+    .completed   = ida_dirty_completed,
+    .combine     = ida_combine_fxattrop,
+    .rebuild     = ida_rebuild_fxattrop,
+    .copy        = ida_copy_fxattrop,
+    .fingerprint = ida_fingerprint_fxattrop
+};
+
+static ida_handlers_t ida_dirty_unmark_handlers =
+{
+    .prepare     = ida_prepare_xattrop,
+    .dispatch    = ida_dispatch_all,
+    .completed   = ida_dirty_unmarked,
+    .combine     = ida_combine_xattrop,
+    .rebuild     = ida_rebuild_xattrop,
+    .copy        = ida_copy_xattrop,
+    .fingerprint = ida_fingerprint_xattrop
+};
+
+// Returns the slots covered by a range of the file, one bit per slot.
+static uint64_t ida_dirty_slots(ida_private_t * ida, off_t offset,
+                                size_t size)
+{
+    uint64_t first, last, slots;
+
+    if (size >= (uint64_t)ida->dirty_size * IDA_DIRTY_SLOTS)
+    {
+        return ~0ULL;
+    }
+
+    first = offset / ida->dirty_size;
+    last = (offset + size - 1) / ida->dirty_size;
+    if (last - first >= IDA_DIRTY_SLOTS)
+    {
+        return ~0ULL;
+    }
+
+    slots = 0;
+    while (first <= last)
+    {
+        slots |= 1ULL << (first % IDA_DIRTY_SLOTS);
+        first++;
+    }
+
+    return slots;
+}
+
+// Builds the argument of a GF_XATTROP_ADD_ARRAY that adds 'counters'
+// multiplied by 'sign' to the stored ones.
+err_t ida_dirty_dict(int32_t * counters, int32_t sign, dict_t ** dict)
+{
+    int32_t * array;
+    data_t * data;
+    int32_t i;
+
+    array = GF_CALLOC(IDA_DIRTY_SLOTS, sizeof(int32_t), ida_mt_uint8_t);
+    if (array == NULL)
+    {
+        return ENOMEM;
+    }
+    for (i = 0; i < IDA_DIRTY_SLOTS; i++)
+    {
+        array[i] = htonl(counters[i] * sign);
+    }
+
+    data = data_from_dynptr(array, sizeof(int32_t) * IDA_DIRTY_SLOTS);
+    if (data == NULL)
+    {
+        GF_FREE(array);
+
+        return ENOMEM;
+    }
+
+    *dict = NULL;
+    SYS_CALL(
+        sys_dict_set, (dict, IDA_KEY_DIRTY, data, NULL),
+        E(),
+        GOTO(failed)
+    );
+
+    return 0;
+
+failed:
+    data_unref(data);
+
+    return ENOMEM;
+}
+
+bool ida_dirty_get(dict_t * xdata, int32_t * counters)
+{
+    data_t * data;
+    int32_t i;
+
+    if (xdata == NULL)
+    {
+        return false;
+    }
+    data = dict_get(xdata, IDA_KEY_DIRTY);
+    if ((data == NULL) || (data->len != sizeof(int32_t) * IDA_DIRTY_SLOTS))
+    {
+        return false;
+    }
+
+    memcpy(counters, data->data, data->len);
+    for (i = 0; i < IDA_DIRTY_SLOTS; i++)
+    {
+        counters[i] = ntohl(counters[i]);
+    }
+
+    return true;
+}
+
+bool ida_dirty_any(int32_t * counters)
+{
+    int32_t i;
+
+    for (i = 0; i < IDA_DIRTY_SLOTS; i++)
+    {
+        if (counters[i] != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ida_dirty_test(ida_private_t * ida, int32_t * counters, off_t offset)
+{
+    return counters[(offset / ida->dirty_size) % IDA_DIRTY_SLOTS] != 0;
+}
+
+static inode_t * ida_dirty_inode(ida_request_t * req)
+{
+    if (req->loc1.inode != NULL)
+    {
+        return req->loc1.inode;
+    }
+
+    return req->fd->inode;
+}
+
+// The state is kept in the second value of the inode context. The first one
+// is used by heals.
+static ida_dirty_inode_t * ida_dirty_state(xlator_t * xl, inode_t * inode)
+{
+    ida_dirty_inode_t * state;
+    uint64_t value;
+
+    LOCK(&inode->lock);
+
+    if ((__inode_ctx_get2(inode, xl, NULL, &value) == 0) && (value != 0))
+    {
+        state = (ida_dirty_inode_t *)(uintptr_t)value;
+    }
+    else
+    {
+        SYS_MALLOC0(
+            &state, ida_mt_ida_dirty_inode_t,
+            E(),
+            GOTO(failed)
+        );
+        LOCK_INIT(&state->lock);
+        INIT_LIST_HEAD(&state->waiting);
+
+        value = (uint64_t)(uintptr_t)state;
+        SYS_CODE(
+            __inode_ctx_set2, (inode, xl, NULL, &value),
+            ENOMEM,
+            E(),
+            GOTO(failed_state)
+        );
+    }
+
+    UNLOCK(&inode->lock);
+
+    return state;
+
+failed_state:
+    LOCK_DESTROY(&state->lock);
+    SYS_FREE(state);
+failed:
+    UNLOCK(&inode->lock);
+
+    return NULL;
+}
+
+// Called when the inode is forgotten. Pending requests and delays keep a
+// reference to the inode, so the state is not in use anymore.
+void ida_dirty_forget(xlator_t * xl, inode_t * inode)
+{
+    ida_dirty_inode_t * state;
+    uint64_t value;
+
+    if ((inode_ctx_get2(inode, xl, NULL, &value) == 0) && (value != 0))
+    {
+        state = (ida_dirty_inode_t *)(uintptr_t)value;
+        LOCK_DESTROY(&state->lock);
+        SYS_FREE(state);
+    }
+}
+
+// Sends an xattrop that adds 'sign' to the counters of 'slots'.
+static err_t ida_dirty_send(ida_private_t * ida, call_frame_t * frame,
+                            ida_handlers_t * handlers, loc_t * loc,
+                            fd_t * fd, uintptr_t bad, int32_t required,
+                            uint64_t slots, int32_t sign)
+{
+    int32_t counters[IDA_DIRTY_SLOTS];
+    dict_t * dict;
+    int32_t i;
+
+    for (i = 0; i < IDA_DIRTY_SLOTS; i++)
+    {
+        counters[i] = (slots >> i) & 1;
+    }
+    SYS_CALL(
+        ida_dirty_dict, (counters, sign, &dict),
+        E(),
+        RETERR()
+    );
+
+    if (fd == NULL)
+    {
+        SYS_ASYNC(
+            ida_xattrop, (frame, ida->xl, handlers, IDA_USE_DFC, bad,
+                          ida->fragments, required, NULL, NULL, NULL, loc,
+                          GF_XATTROP_ADD_ARRAY, dict, NULL)
+        );
+    }
+    else
+    {
+        SYS_ASYNC(
+            ida_fxattrop, (frame, ida->xl, handlers, IDA_USE_DFC, bad,
+                           ida->fragments, required, NULL, NULL, NULL, fd,
+                           GF_XATTROP_ADD_ARRAY, dict, NULL)
+        );
+    }
+
+    sys_dict_release(dict);
+
+    return 0;
+}
+
+// Removes the increments of the slots that have been idle since the delay
+// was armed.
+SYS_DELAY_CREATE(ida_dirty_linger, ((xlator_t *, xl), (inode_t *, inode),
+                                    (ida_dirty_inode_t *, state)))
+{
+    ida_private_t * ida;
+    call_frame_t * frame;
+    uint64_t slots;
+    loc_t loc;
+
+    ida = xl->private;
+
+    LOCK(&state->lock);
+
+    if (state->delay != NULL)
+    {
+        sys_delay_release(state->delay);
+        state->delay = NULL;
+    }
+    slots = state->idle;
+    state->idle = 0;
+    if (state->busy == 0)
+    {
+        state->marked = 0;
+    }
+
+    UNLOCK(&state->lock);
+
+    if (slots != 0)
+    {
+        memset(&loc, 0, sizeof(loc));
+        loc.inode = inode;
+        uuid_copy(loc.gfid, inode->gfid);
+
+        SYS_PTR(
+            &frame, create_frame, (xl, xl->ctx->pool),
+            ENOMEM,
+            E(),
+            GOTO(done)
+        );
+        SYS_CALL(
+            ida_dirty_send, (ida, frame, &ida_dirty_unmark_handlers, &loc,
+                             NULL, 0, ida->nodes, slots, -1),
+            E(),
+            LOG(W(), "Unable to remove the record of modified regions."),
+            GOTO(failed)
+        );
+    }
+
+    goto done;
+
+failed:
+    STACK_DESTROY(frame->root);
+done:
+    inode_unref(inode);
+}
+
+// Releases the slots of a modification. Their increments are kept if it has
+// not succeeded on all subvolumes.
+static void __ida_dirty_release(xlator_t * xl, inode_t * inode,
+                                ida_dirty_inode_t * state, uint64_t slots,
+                                bool keep)
+{
+    uint64_t bit;
+    int32_t i;
+
+    if (keep)
+    {
+        state->keep |= slots;
+    }
+    while (slots != 0)
+    {
+        i = sys_bits_first_one_index64(slots);
+        bit = 1ULL << i;
+        slots ^= bit;
+
+        if (--state->held[i] == 0)
+        {
+            state->busy &= ~bit;
+            if ((state->keep & bit) == 0)
+            {
+                state->idle |= bit;
+            }
+            state->keep &= ~bit;
+        }
+    }
+
+    if ((state->idle != 0) && (state->delay == NULL))
+    {
+        state->delay = SYS_DELAY(IDA_DIRTY_LINGER, ida_dirty_linger,
+                                 (xl, inode_ref(inode), state), 1);
+        if (state->delay == NULL)
+        {
+            // The increments stay. They will only cause an unneeded heal.
+            logW("Unable to schedule the removal of modified regions.");
+            inode_unref(inode);
+            state->idle = 0;
+        }
+    }
+    if ((state->busy | state->idle) == 0)
+    {
+        state->marked = 0;
+    }
+}
+
+// Takes the slots of a request and returns the ones that still need to be
+// incremented. The others are already recorded on the subvolumes in
+// 'marked', which are the only ones that can receive the request.
+static uint64_t __ida_dirty_acquire(ida_dirty_inode_t * state,
+                                    ida_request_t * req)
+{
+    uint64_t slots, need;
+    int32_t i;
+
+    if (state->marked != 0)
+    {
+        req->bad |= ~state->marked;
+    }
+
+    need = req->dirty_slots & ~(state->busy | state->idle);
+
+    slots = req->dirty_slots;
+    while (slots != 0)
+    {
+        i = sys_bits_first_one_index64(slots);
+        slots ^= 1ULL << i;
+        state->held[i]++;
+    }
+    state->busy |= req->dirty_slots;
+    state->idle &= ~req->dirty_slots;
+
+    return need;
+}
+
+static void ida_dirty_marked(ida_private_t * ida, ida_dirty_mark_t * mark,
+                             uintptr_t marked);
+
+// Sends the increment needed by the first waiting request. Only one can be
+// in progress for each inode.
+static void ida_dirty_increment(ida_private_t * ida, ida_dirty_mark_t * mark)
+{
+    ida_request_t * req;
+    ida_handlers_t * handlers;
+    uintptr_t mask;
+
+    req = mark->req;
+
+    ida_stats_add(&ida->stats, IDA_STATS_DIRTY_MARKS, 1);
+
+    handlers = &ida_dirty_handlers_fxattrop;
+    if (req->loc1.inode != NULL)
+    {
+        handlers = &ida_dirty_handlers_xattrop;
+    }
+    mask = ida->xl_up & ~req->bad & ida->node_mask;
+
+    req->rframe->local = mark;
+    SYS_CALL(
+        ida_dirty_send, (ida, req->rframe, handlers, &req->loc1,
+                         (req->loc1.inode != NULL) ? NULL : req->fd,
+                         req->bad, sys_bits_count64(mask), mark->need, 1),
+        E(),
+        GOTO(failed)
+    );
+
+    return;
+
+failed:
+    req->rframe->local = NULL;
+    ida_dirty_marked(ida, mark, 0);
+}
+
+// Dispatches the waiting requests in order until one of them needs a new
+// increment.
+static void ida_dirty_resume(ida_private_t * ida, ida_dirty_inode_t * state)
+{
+    ida_dirty_mark_t * mark;
+
+    LOCK(&state->lock);
+
+    while (!list_empty(&state->waiting))
+    {
+        mark = list_entry(state->waiting.next, ida_dirty_mark_t, list);
+        mark->need = __ida_dirty_acquire(state, mark->req);
+        if (mark->need != 0)
+        {
+            UNLOCK(&state->lock);
+
+            ida_dirty_increment(ida, mark);
+
+            return;
+        }
+        list_del_init(&mark->list);
+
+        UNLOCK(&state->lock);
+
+        mark->dispatch(ida, mark->req);
+        ida_pool_free(mark);
+
+        LOCK(&state->lock);
+    }
+    state->marking = false;
+
+    UNLOCK(&state->lock);
+}
+
+static void ida_dirty_marked(ida_private_t * ida, ida_dirty_mark_t * mark,
+                             uintptr_t marked)
+{
+    ida_dirty_inode_t * state;
+    ida_request_t * req;
+
+    state = mark->state;
+    req = mark->req;
+
+    LOCK(&state->lock);
+
+    list_del_init(&mark->list);
+    if (marked == 0)
+    {
+        logE("Unable to record modified regions.");
+
+        // Nobody else holds the slots that needed the increment, and they
+        // don't have it anywhere. The request fails when dispatched.
+        __ida_dirty_release(req->xl, ida_dirty_inode(req), state,
+                            mark->need, true);
+        __ida_dirty_release(req->xl, ida_dirty_inode(req), state,
+                            req->dirty_slots & ~mark->need, false);
+        req->dirty_slots = 0;
+        req->bad |= ida->node_mask;
+    }
+    else
+    {
+        // Subvolumes that haven't recorded the modification must not
+        // receive it, otherwise they could be considered healthy while they
+        // are not.
+        if (state->marked != 0)
+        {
+            marked &= state->marked;
+        }
+        state->marked = marked;
+        req->bad |= ~marked;
+    }
+
+    UNLOCK(&state->lock);
+
+    mark->dispatch(ida, req);
+    ida_pool_free(mark);
+
+    ida_dirty_resume(ida, state);
+}
+
+static void ida_dirty_completed(call_frame_t * frame, err_t error,
+                                ida_request_t * req, uintptr_t * data)
+{
+    SYS_GF_CBK_CALL_TYPE(xattrop) * args;
+    ida_dirty_mark_t * mark;
+    ida_answer_t * ans;
+    uintptr_t marked;
+
+    mark = frame->local;
+    frame->local = NULL;
+
+    marked = 0;
+    if ((error == 0) && (data != NULL))
+    {
+        args = (SYS_GF_CBK_CALL_TYPE(xattrop) *)data;
+        if (args->op_ret >= 0)
+        {
+            ans = list_entry(req->answers.next, ida_answer_t, list);
+            marked = ans->mask;
+        }
+    }
+    if (marked == 0)
+    {
+        logE("Unable to record modified regions (error %d).", error);
+    }
+
+    ida_dirty_marked(mark->req->xl->private, mark, marked);
+}
+
+// Records the range modified by a request before dispatching it. Even if all
+// subvolumes are up, any of them could fail the modification. Returns false
+// if the request can be dispatched right now. Otherwise 'dispatch' will be
+// called once the range has been recorded and all previous requests of the
+// inode have been dispatched.
+bool ida_dirty_mark(ida_private_t * ida, ida_request_t * req, off_t offset,
+                    size_t size, ida_dirty_dispatch_f dispatch)
+{
+    ida_dirty_inode_t * state;
+    ida_dirty_mark_t * mark;
+    uint64_t need;
+
+    if ((ida->dirty_size == 0) || req->dirty || (req->sent != 0) ||
+        (req->minimum < ida->fragments) || (size == 0))
+    {
+        return false;
+    }
+    req->dirty = true;
+    req->dirty_slots = 0;
+
+    state = ida_dirty_state(req->xl, ida_dirty_inode(req));
+    if (state == NULL)
+    {
+        goto failed;
+    }
+    mark = ida_pool_alloc(sizeof(ida_dirty_mark_t));
+    if (mark == NULL)
+    {
+        goto failed;
+    }
+    mark->state = state;
+    mark->req = req;
+    mark->dispatch = dispatch;
+    req->dirty_slots = ida_dirty_slots(ida, offset, size);
+
+    LOCK(&state->lock);
+
+    if (state->marking)
+    {
+        list_add_tail(&mark->list, &state->waiting);
+
+        UNLOCK(&state->lock);
+
+        return true;
+    }
+
+    need = __ida_dirty_acquire(state, req);
+    if (need != 0)
+    {
+        mark->need = need;
+        state->marking = true;
+        list_add_tail(&mark->list, &state->waiting);
+    }
+
+    UNLOCK(&state->lock);
+
+    if (need == 0)
+    {
+        ida_pool_free(mark);
+
+        return false;
+    }
+
+    ida_dirty_increment(ida, mark);
+
+    return true;
+
+failed:
+    logE("Unable to record modified regions.");
+
+    // The request fails when dispatched.
+    req->bad |= ida->node_mask;
+
+    return false;
+}
+
+static void ida_dirty_release(ida_request_t * req, bool keep)
+{
+    ida_dirty_inode_t * state;
+    inode_t * inode;
+    uint64_t value;
+
+    if (!req->dirty || (req->dirty_slots == 0))
+    {
+        return;
+    }
+
+    inode = ida_dirty_inode(req);
+    if ((inode_ctx_get2(inode, req->xl, NULL, &value) != 0) || (value == 0))
+    {
+        return;
+    }
+    state = (ida_dirty_inode_t *)(uintptr_t)value;
+
+    LOCK(&state->lock);
+    __ida_dirty_release(req->xl, inode, state, req->dirty_slots, keep);
+    UNLOCK(&state->lock);
+
+    req->dirty_slots = 0;
+}
+
+// Releases the slots of a completed request. Its increments are kept if it
+// has not succeeded on all subvolumes, so that the ones that have missed or
+// failed the modification will heal the recorded range.
+void ida_dirty_unmark(ida_private_t * ida, ida_request_t * req,
+                      ida_answer_t * ans)
+{
+    SYS_GF_CBK_CALL_TYPE(access) * args;
+
+    args = (SYS_GF_CBK_CALL_TYPE(access) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+    ida_dirty_release(req, (args->op_ret < 0) ||
+                           (ans->mask != ida->node_mask));
+}
+
+// Releases the slots of a request that has failed before being sent to any
+// subvolume.
+void ida_dirty_cancel(ida_request_t * req)
+{
+    ida_dirty_release(req, false);
+}
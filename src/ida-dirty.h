@@ -0,0 +1,46 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_DIRTY_H__
+#define __IDA_DIRTY_H__
+
+#include "xlator.h"
+
+#include "ida-types.h"
+#include "ida-manager.h"
+
+// Size used to mark all regions of a file as modified.
+#define IDA_DIRTY_ALL SIZE_MAX
+
+typedef void (* ida_dirty_dispatch_f)(ida_private_t *, ida_request_t *);
+
+bool ida_dirty_mark(ida_private_t * ida, ida_request_t * req, off_t offset,
+                    size_t size, ida_dirty_dispatch_f dispatch);
+void ida_dirty_unmark(ida_private_t * ida, ida_request_t * req,
+                      ida_answer_t * ans);
+void ida_dirty_cancel(ida_request_t * req);
+void ida_dirty_forget(xlator_t * xl, inode_t * inode);
+
+err_t ida_dirty_dict(int32_t * counters, int32_t sign, dict_t ** dict);
+bool ida_dirty_get(dict_t * xdata, int32_t * counters);
+bool ida_dirty_any(int32_t * counters);
+bool ida_dirty_test(ida_private_t * ida, int32_t * counters, off_t offset);
+
+#endif /* __IDA_DIRTY_H__ */
@@ -0,0 +1,140 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+/*
+ * File automatically generated
+ *
+ * DO NOT MODIFY
+ *
+ * Multiplications in a GF(2^8) with modulus 0x11D using XOR's
+ * (AVX2 version, 2 groups of 128 bytes per operation)
+ *
+ * Each ymm register holds the same 16-byte word of 2 consecutive groups, so
+ * the fragments produced are identical to the ones of the SSE2 version.
+ *
+ */
+
+#ifndef _IDA_GF_AVX2_H
+#define _IDA_GF_AVX2_H
+
+#include "ida-gf.h"
+
+#define IDA_GF_AVX2_GROUPS 2
+
+#define ida_gf_avx2_load(addr0, addr1) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  0*16(%0), %%xmm0\n" \
+            "\tvinserti128 $1, 0*16(%1), %%ymm0, %%ymm0\n" \
+            "\tvmovdqa  1*16(%0), %%xmm1\n" \
+            "\tvinserti128 $1, 1*16(%1), %%ymm1, %%ymm1\n" \
+            "\tvmovdqa  2*16(%0), %%xmm2\n" \
+            "\tvinserti128 $1, 2*16(%1), %%ymm2, %%ymm2\n" \
+            "\tvmovdqa  3*16(%0), %%xmm3\n" \
+            "\tvinserti128 $1, 3*16(%1), %%ymm3, %%ymm3\n" \
+            "\tvmovdqa  4*16(%0), %%xmm4\n" \
+            "\tvinserti128 $1, 4*16(%1), %%ymm4, %%ymm4\n" \
+            "\tvmovdqa  5*16(%0), %%xmm5\n" \
+            "\tvinserti128 $1, 5*16(%1), %%ymm5, %%ymm5\n" \
+            "\tvmovdqa  6*16(%0), %%xmm6\n" \
+            "\tvinserti128 $1, 6*16(%1), %%ymm6, %%ymm6\n" \
+            "\tvmovdqa  7*16(%0), %%xmm7\n" \
+            "\tvinserti128 $1, 7*16(%1), %%ymm7, %%ymm7\n" \
+            : \
+            : "r" (addr0), "r" (addr1) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx2_store(addr0, addr1) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  %%xmm0, 0*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm0, 0*16(%1)\n" \
+            "\tvmovdqa  %%xmm1, 1*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm1, 1*16(%1)\n" \
+            "\tvmovdqa  %%xmm2, 2*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm2, 2*16(%1)\n" \
+            "\tvmovdqa  %%xmm3, 3*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm3, 3*16(%1)\n" \
+            "\tvmovdqa  %%xmm4, 4*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm4, 4*16(%1)\n" \
+            "\tvmovdqa  %%xmm5, 5*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm5, 5*16(%1)\n" \
+            "\tvmovdqa  %%xmm6, 6*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm6, 6*16(%1)\n" \
+            "\tvmovdqa  %%xmm7, 7*16(%0)\n" \
+            "\tvextracti128 $1, %%ymm7, 7*16(%1)\n" \
+            : \
+            : "r" (addr0), "r" (addr1) \
+            : "memory" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx2_xor(addr0, addr1) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  0*16(%0), %%xmm8\n" \
+            "\tvinserti128 $1, 0*16(%1), %%ymm8, %%ymm8\n" \
+            "\tvpxor   %%ymm8, %%ymm0, %%ymm0\n" \
+            "\tvmovdqa  1*16(%0), %%xmm9\n" \
+            "\tvinserti128 $1, 1*16(%1), %%ymm9, %%ymm9\n" \
+            "\tvpxor   %%ymm9, %%ymm1, %%ymm1\n" \
+            "\tvmovdqa  2*16(%0), %%xmm10\n" \
+            "\tvinserti128 $1, 2*16(%1), %%ymm10, %%ymm10\n" \
+            "\tvpxor   %%ymm10, %%ymm2, %%ymm2\n" \
+            "\tvmovdqa  3*16(%0), %%xmm11\n" \
+            "\tvinserti128 $1, 3*16(%1), %%ymm11, %%ymm11\n" \
+            "\tvpxor   %%ymm11, %%ymm3, %%ymm3\n" \
+            "\tvmovdqa  4*16(%0), %%xmm12\n" \
+            "\tvinserti128 $1, 4*16(%1), %%ymm12, %%ymm12\n" \
+            "\tvpxor   %%ymm12, %%ymm4, %%ymm4\n" \
+            "\tvmovdqa  5*16(%0), %%xmm13\n" \
+            "\tvinserti128 $1, 5*16(%1), %%ymm13, %%ymm13\n" \
+            "\tvpxor   %%ymm13, %%ymm5, %%ymm5\n" \
+            "\tvmovdqa  6*16(%0), %%xmm14\n" \
+            "\tvinserti128 $1, 6*16(%1), %%ymm14, %%ymm14\n" \
+            "\tvpxor   %%ymm14, %%ymm6, %%ymm6\n" \
+            "\tvmovdqa  7*16(%0), %%xmm15\n" \
+            "\tvinserti128 $1, 7*16(%1), %%ymm15, %%ymm15\n" \
+            "\tvpxor   %%ymm15, %%ymm7, %%ymm7\n" \
+            : \
+            : "r" (addr0), "r" (addr1) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", \
+              "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx2_end() \
+    do \
+    { \
+        __asm__ __volatile__ ("\tvzeroupper\n"); \
+    } while (0)
+
+extern void (* ida_gf_avx2_mul_table[])(void);
+
+#endif // _IDA_GF_AVX2_H
@@ -0,0 +1,188 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+/*
+ * File automatically generated
+ *
+ * DO NOT MODIFY
+ *
+ * Multiplications in a GF(2^8) with modulus 0x11D using XOR's
+ * (AVX-512 version, 4 groups of 128 bytes per operation)
+ *
+ * Each zmm register holds the same 16-byte word of 4 consecutive groups, so
+ * the fragments produced are identical to the ones of the SSE2 version.
+ *
+ */
+
+#ifndef _IDA_GF_AVX512_H
+#define _IDA_GF_AVX512_H
+
+#include "ida-gf.h"
+
+#define IDA_GF_AVX512_GROUPS 4
+
+#define ida_gf_avx512_load(addr0, addr1, addr2, addr3) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  0*16(%0), %%xmm0\n" \
+            "\tvinserti32x4 $1, 0*16(%1), %%zmm0, %%zmm0\n" \
+            "\tvinserti32x4 $2, 0*16(%2), %%zmm0, %%zmm0\n" \
+            "\tvinserti32x4 $3, 0*16(%3), %%zmm0, %%zmm0\n" \
+            "\tvmovdqa  1*16(%0), %%xmm1\n" \
+            "\tvinserti32x4 $1, 1*16(%1), %%zmm1, %%zmm1\n" \
+            "\tvinserti32x4 $2, 1*16(%2), %%zmm1, %%zmm1\n" \
+            "\tvinserti32x4 $3, 1*16(%3), %%zmm1, %%zmm1\n" \
+            "\tvmovdqa  2*16(%0), %%xmm2\n" \
+            "\tvinserti32x4 $1, 2*16(%1), %%zmm2, %%zmm2\n" \
+            "\tvinserti32x4 $2, 2*16(%2), %%zmm2, %%zmm2\n" \
+            "\tvinserti32x4 $3, 2*16(%3), %%zmm2, %%zmm2\n" \
+            "\tvmovdqa  3*16(%0), %%xmm3\n" \
+            "\tvinserti32x4 $1, 3*16(%1), %%zmm3, %%zmm3\n" \
+            "\tvinserti32x4 $2, 3*16(%2), %%zmm3, %%zmm3\n" \
+            "\tvinserti32x4 $3, 3*16(%3), %%zmm3, %%zmm3\n" \
+            "\tvmovdqa  4*16(%0), %%xmm4\n" \
+            "\tvinserti32x4 $1, 4*16(%1), %%zmm4, %%zmm4\n" \
+            "\tvinserti32x4 $2, 4*16(%2), %%zmm4, %%zmm4\n" \
+            "\tvinserti32x4 $3, 4*16(%3), %%zmm4, %%zmm4\n" \
+            "\tvmovdqa  5*16(%0), %%xmm5\n" \
+            "\tvinserti32x4 $1, 5*16(%1), %%zmm5, %%zmm5\n" \
+            "\tvinserti32x4 $2, 5*16(%2), %%zmm5, %%zmm5\n" \
+            "\tvinserti32x4 $3, 5*16(%3), %%zmm5, %%zmm5\n" \
+            "\tvmovdqa  6*16(%0), %%xmm6\n" \
+            "\tvinserti32x4 $1, 6*16(%1), %%zmm6, %%zmm6\n" \
+            "\tvinserti32x4 $2, 6*16(%2), %%zmm6, %%zmm6\n" \
+            "\tvinserti32x4 $3, 6*16(%3), %%zmm6, %%zmm6\n" \
+            "\tvmovdqa  7*16(%0), %%xmm7\n" \
+            "\tvinserti32x4 $1, 7*16(%1), %%zmm7, %%zmm7\n" \
+            "\tvinserti32x4 $2, 7*16(%2), %%zmm7, %%zmm7\n" \
+            "\tvinserti32x4 $3, 7*16(%3), %%zmm7, %%zmm7\n" \
+            : \
+            : "r" (addr0), "r" (addr1), "r" (addr2), "r" (addr3) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx512_store(addr0, addr1, addr2, addr3) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  %%xmm0, 0*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm0, 0*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm0, 0*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm0, 0*16(%3)\n" \
+            "\tvmovdqa  %%xmm1, 1*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm1, 1*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm1, 1*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm1, 1*16(%3)\n" \
+            "\tvmovdqa  %%xmm2, 2*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm2, 2*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm2, 2*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm2, 2*16(%3)\n" \
+            "\tvmovdqa  %%xmm3, 3*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm3, 3*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm3, 3*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm3, 3*16(%3)\n" \
+            "\tvmovdqa  %%xmm4, 4*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm4, 4*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm4, 4*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm4, 4*16(%3)\n" \
+            "\tvmovdqa  %%xmm5, 5*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm5, 5*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm5, 5*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm5, 5*16(%3)\n" \
+            "\tvmovdqa  %%xmm6, 6*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm6, 6*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm6, 6*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm6, 6*16(%3)\n" \
+            "\tvmovdqa  %%xmm7, 7*16(%0)\n" \
+            "\tvextracti32x4 $1, %%zmm7, 7*16(%1)\n" \
+            "\tvextracti32x4 $2, %%zmm7, 7*16(%2)\n" \
+            "\tvextracti32x4 $3, %%zmm7, 7*16(%3)\n" \
+            : \
+            : "r" (addr0), "r" (addr1), "r" (addr2), "r" (addr3) \
+            : "memory" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx512_xor(addr0, addr1, addr2, addr3) \
+    do \
+    { \
+        __asm__ __volatile__ \
+        ( \
+            "\tvmovdqa  0*16(%0), %%xmm8\n" \
+            "\tvinserti32x4 $1, 0*16(%1), %%zmm8, %%zmm8\n" \
+            "\tvinserti32x4 $2, 0*16(%2), %%zmm8, %%zmm8\n" \
+            "\tvinserti32x4 $3, 0*16(%3), %%zmm8, %%zmm8\n" \
+            "\tvpxorq  %%zmm8, %%zmm0, %%zmm0\n" \
+            "\tvmovdqa  1*16(%0), %%xmm9\n" \
+            "\tvinserti32x4 $1, 1*16(%1), %%zmm9, %%zmm9\n" \
+            "\tvinserti32x4 $2, 1*16(%2), %%zmm9, %%zmm9\n" \
+            "\tvinserti32x4 $3, 1*16(%3), %%zmm9, %%zmm9\n" \
+            "\tvpxorq  %%zmm9, %%zmm1, %%zmm1\n" \
+            "\tvmovdqa  2*16(%0), %%xmm10\n" \
+            "\tvinserti32x4 $1, 2*16(%1), %%zmm10, %%zmm10\n" \
+            "\tvinserti32x4 $2, 2*16(%2), %%zmm10, %%zmm10\n" \
+            "\tvinserti32x4 $3, 2*16(%3), %%zmm10, %%zmm10\n" \
+            "\tvpxorq  %%zmm10, %%zmm2, %%zmm2\n" \
+            "\tvmovdqa  3*16(%0), %%xmm11\n" \
+            "\tvinserti32x4 $1, 3*16(%1), %%zmm11, %%zmm11\n" \
+            "\tvinserti32x4 $2, 3*16(%2), %%zmm11, %%zmm11\n" \
+            "\tvinserti32x4 $3, 3*16(%3), %%zmm11, %%zmm11\n" \
+            "\tvpxorq  %%zmm11, %%zmm3, %%zmm3\n" \
+            "\tvmovdqa  4*16(%0), %%xmm12\n" \
+            "\tvinserti32x4 $1, 4*16(%1), %%zmm12, %%zmm12\n" \
+            "\tvinserti32x4 $2, 4*16(%2), %%zmm12, %%zmm12\n" \
+            "\tvinserti32x4 $3, 4*16(%3), %%zmm12, %%zmm12\n" \
+            "\tvpxorq  %%zmm12, %%zmm4, %%zmm4\n" \
+            "\tvmovdqa  5*16(%0), %%xmm13\n" \
+            "\tvinserti32x4 $1, 5*16(%1), %%zmm13, %%zmm13\n" \
+            "\tvinserti32x4 $2, 5*16(%2), %%zmm13, %%zmm13\n" \
+            "\tvinserti32x4 $3, 5*16(%3), %%zmm13, %%zmm13\n" \
+            "\tvpxorq  %%zmm13, %%zmm5, %%zmm5\n" \
+            "\tvmovdqa  6*16(%0), %%xmm14\n" \
+            "\tvinserti32x4 $1, 6*16(%1), %%zmm14, %%zmm14\n" \
+            "\tvinserti32x4 $2, 6*16(%2), %%zmm14, %%zmm14\n" \
+            "\tvinserti32x4 $3, 6*16(%3), %%zmm14, %%zmm14\n" \
+            "\tvpxorq  %%zmm14, %%zmm6, %%zmm6\n" \
+            "\tvmovdqa  7*16(%0), %%xmm15\n" \
+            "\tvinserti32x4 $1, 7*16(%1), %%zmm15, %%zmm15\n" \
+            "\tvinserti32x4 $2, 7*16(%2), %%zmm15, %%zmm15\n" \
+            "\tvinserti32x4 $3, 7*16(%3), %%zmm15, %%zmm15\n" \
+            "\tvpxorq  %%zmm15, %%zmm7, %%zmm7\n" \
+            : \
+            : "r" (addr0), "r" (addr1), "r" (addr2), "r" (addr3) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", \
+              "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15" \
+        ); \
+    } while (0)
+
+#define ida_gf_avx512_end() \
+    do \
+    { \
+        __asm__ __volatile__ ("\tvzeroupper\n"); \
+    } while (0)
+
+extern void (* ida_gf_avx512_mul_table[])(void);
+
+#endif // _IDA_GF_AVX512_H
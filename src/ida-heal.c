@@ -22,26 +22,33 @@
 
 #include "ida-common.h"
 #include "ida-mem-types.h"
+#include "ida-pool.h"
 #include "ida-type-dict.h"
 #include "ida-type-loc.h"
 #include "ida-gf.h"
 #include "ida-manager.h"
 #include "ida-combine.h"
 #include "ida-heal.h"
+#include "ida-dirty.h"
 #include "ida.h"
 
 #define IDA_HEAL_FLAG_RETRY     1
 #define IDA_HEAL_FLAG_DATA      2
-
-#define IDA_HEAL_FOP(_name, _fop, _dispatcher, _req_handler, _ans_handler, \
-                     _end_handler) \
+#define IDA_HEAL_FLAG_EOF       4
+#define IDA_HEAL_FLAG_ABORT     8
+#define IDA_HEAL_FLAG_SPARSE   16
+#define IDA_HEAL_FLAG_TRACKED  32
+#define IDA_HEAL_FLAG_DIRTY    64
+
+#define IDA_HEAL_FOP_HANDLERS(_name, _fop, _prepare, _dispatcher, _rebuild, \
+                              _req_handler, _ans_handler, _end_handler) \
     void _name##_completed(call_frame_t * frame, err_t error, \
                            ida_request_t * req, uintptr_t * data) \
     { \
         ida_answer_t * ans; \
         SYS_GF_CBK_CALL_TYPE(_fop) * args; \
         int32_t idx; \
-        char buff[64]; \
+        char buff[65]; \
         ida_heal_t * heal = frame->local; \
         logI("HEAL: " #_fop ": completed (refs=%d)", heal->refs); \
         if (!_req_handler(heal, req, data, error)) \
@@ -66,17 +73,18 @@
     } \
     static ida_handlers_t _name##_handlers = \
     { \
-        .prepare   = ida_prepare_##_fop, \
-        .dispatch  = _dispatcher, \
-        .completed = _name##_completed, \
-        .combine   = ida_combine_##_fop, \
-        .rebuild   = ida_rebuild_##_fop, \
-        .copy      = ida_copy_##_fop \
+        .prepare     = _prepare, \
+        .dispatch    = _dispatcher, \
+        .completed   = _name##_completed, \
+        .combine     = ida_combine_##_fop, \
+        .rebuild     = _rebuild, \
+        .copy        = ida_copy_##_fop, \
+        .fingerprint = ida_fingerprint_##_fop \
     }; \
     void _name(ida_heal_t * heal, uintptr_t mask, dfc_transaction_t * txn, \
                int32_t minimum, SYS_ARGS_DECL((SYS_GF_ARGS_##_fop))) \
     { \
-        char buff[64]; \
+        char buff[65]; \
         ida_heal_acquire(heal); \
         logI("HEAL: " #_fop ": starting %s (refs=%d)", \
              to_bin(buff, sizeof(buff), mask, 3), heal->refs); \
@@ -87,6 +95,12 @@
         ); \
     }
 
+#define IDA_HEAL_FOP(_name, _fop, _dispatcher, _req_handler, _ans_handler, \
+                     _end_handler) \
+    IDA_HEAL_FOP_HANDLERS(_name, _fop, ida_prepare_##_fop, _dispatcher, \
+                          ida_rebuild_##_fop, _req_handler, _ans_handler, \
+                          _end_handler)
+
 char * to_bin(char * buffer, int32_t size, uintptr_t num, int32_t digits)
 {
     if (size < 1)
@@ -285,16 +299,23 @@ void ida_heal_cleanup(ida_heal_t * heal)
     heal->bad = 0;
     heal->open = 0;
     heal->offset = 0;
+    heal->inflight = 0;
 }
 
 void ida_heal_destroy(ida_heal_t * heal)
 {
+    ida_private_t * ida;
+
+    ida = heal->xl->private;
+    ida_stats_add(&ida->stats, IDA_STATS_HEALS_FINISHED, 1);
+
     SYS_CODE(
-        inode_ctx_del, (heal->loc.inode, heal->xl, NULL),
+        inode_ctx_reset0, (heal->loc.inode, heal->xl, NULL),
         ENOENT,
         W(),
         LOG(W(), "Heal data not present on inode context")
     );
+    atomic_dec(&ida->healing, memory_order_seq_cst);
 
     ida_heal_cleanup(heal);
     sys_loc_release(&heal->loc);
@@ -338,9 +359,13 @@ IDA_HEAL_FOP(
 
 void ida_heal_writev_handler(ida_heal_t * heal);
 
-IDA_HEAL_FOP(
+// Healed fragments are computed before sending them, so each bad subvolume
+// receives its own fragment instead of being encoded again.
+IDA_HEAL_FOP_HANDLERS(
     ida_heal_writev, writev,
-    ida_dispatch_write,
+    ida_prepare_writev_fragments,
+    ida_dispatch_fragments,
+    ida_rebuild_writev,
     ida_default_request_handler,
     ida_heal_skip_bad,
     ida_heal_writev_handler
@@ -348,20 +373,490 @@ IDA_HEAL_FOP(
 
 void ida_heal_metadata_xattr_get(ida_heal_t * heal);
 
+bool ida_heal_readv_handler(ida_heal_t * heal, ida_request_t * req,
+                            uintptr_t * data, err_t error);
+
+// Healthy data is not decoded. The fragments read are used to compute the
+// missing ones.
+IDA_HEAL_FOP_HANDLERS(
+    ida_heal_readv, readv,
+    ida_prepare_readv,
+    ida_dispatch_all,
+    ida_rebuild_readv_fragments,
+    ida_heal_readv_handler,
+    ida_default_answer_handler,
+    ida_default_end_handler
+)
+
+// Data is healed in chunks of 'heal_chunk_size' bytes. Up to 'heal_window'
+// chunks can be read or written at the same time. A chunk is in flight from
+// the time it's read until it has been written. When only the modified
+// regions are healed, the other chunks are skipped.
+static bool ida_heal_data_next(ida_heal_t * heal)
+{
+    ida_private_t * ida;
+    off_t offset;
+
+    if ((heal->flags & (IDA_HEAL_FLAG_EOF | IDA_HEAL_FLAG_ABORT)) != 0)
+    {
+        return false;
+    }
+
+    ida = heal->xl->private;
+
+    offset = atomic_add(&heal->offset, ida->heal_chunk_size,
+                        memory_order_seq_cst);
+    if ((heal->flags & IDA_HEAL_FLAG_DIRTY) != 0)
+    {
+        while (!ida_dirty_test(ida, heal->dirty, offset))
+        {
+            if ((uint64_t)offset >= __atomic_load_n(&heal->size,
+                                                    __ATOMIC_ACQUIRE))
+            {
+                atomic_or(&heal->flags, IDA_HEAL_FLAG_EOF,
+                          memory_order_seq_cst);
+
+                return false;
+            }
+            ida_stats_add(&ida->stats, IDA_STATS_HEAL_CLEAN,
+                          ida->heal_chunk_size);
+            offset = atomic_add(&heal->offset, ida->heal_chunk_size,
+                                memory_order_seq_cst);
+        }
+    }
+
+    atomic_inc(&heal->inflight, memory_order_seq_cst);
+    ida_heal_readv(heal, heal->good, IDA_USE_DFC, ida->fragments,
+                   heal->fd_src, ida->heal_chunk_size, offset, 0, NULL);
+
+    return true;
+}
+
+static void ida_heal_data_put(ida_heal_t * heal);
+
+static void ida_heal_data_start(ida_heal_t * heal)
+{
+    ida_private_t * ida;
+    int32_t i;
+
+    ida = heal->xl->private;
+
+    heal->flags &= ~(IDA_HEAL_FLAG_DATA | IDA_HEAL_FLAG_EOF |
+                     IDA_HEAL_FLAG_ABORT | IDA_HEAL_FLAG_SPARSE);
+
+    // The heal can't finish while the first chunks are being started, even
+    // if none of them needs to be read.
+    heal->inflight = 1;
+
+    // The file can change while it's being healed, so its size is updated
+    // with each chunk read.
+    heal->size = heal->iatt.ia_size;
+
+    for (i = 0; i < ida->heal_window; i++)
+    {
+        if (!ida_heal_data_next(heal))
+        {
+            break;
+        }
+    }
+
+    ida_heal_data_put(heal);
+}
+
+// All data has been healed. Metadata is healed now.
+static void ida_heal_data_finish(ida_heal_t * heal)
+{
+    ida_private_t * ida;
+    uintptr_t good, bad, mask;
+
+    good = heal->good;
+    bad = heal->bad;
+
+    ida = heal->xl->private;
+    ida_heal_cleanup(heal);
+    heal->mask = good | bad;
+    heal->good = good;
+    heal->bad = bad;
+
+    mask = heal->mask;
+    SYS_CALL(
+        dfc_begin, (ida->dfc, mask, heal->loc.inode, NULL,
+                    &heal->txn),
+        E(),
+        LOG(E(), "Unable to initiate a transaction for healing"),
+        RETURN()
+    );
+
+    SYS_CALL(
+        dfc_attach, (heal->txn, 0, &heal->xdata),
+        E(),
+        GOTO(failed_dfc)
+    );
+
+    ida_heal_metadata_xattr_get(heal);
+
+    return;
+
+failed_dfc:
+    dfc_failed(heal->txn, sys_bits_count64(mask));
+}
+
+void ida_heal_dirty_cleared(ida_heal_t * heal)
+{
+    ida_heal_data_finish(heal);
+}
+
+IDA_HEAL_FOP(
+    ida_heal_dirty_clear, fxattrop,
+    ida_dispatch_all,
+    ida_default_request_handler,
+    ida_default_answer_handler,
+    ida_heal_dirty_cleared
+)
+
+// Once all subvolumes are healthy, the modifications seen at the start of
+// the heal are removed from the counters of the healthy subvolumes.
+// Modifications recorded after that are kept. Healed subvolumes get the
+// resulting counters when metadata is healed.
+static void ida_heal_data_clear(ida_heal_t * heal)
+{
+    ida_private_t * ida;
+    dict_t * xattr;
+
+    ida = heal->xl->private;
+
+    if (((heal->flags & IDA_HEAL_FLAG_TRACKED) == 0) ||
+        ((heal->good | heal->bad) != ida->node_mask) ||
+        !ida_dirty_any(heal->dirty))
+    {
+        ida_heal_data_finish(heal);
+
+        return;
+    }
+
+    SYS_CALL(
+        ida_dirty_dict, (heal->dirty, -1, &xattr),
+        E(),
+        GOTO(failed)
+    );
+    ida_heal_dirty_clear(heal, heal->good, IDA_USE_DFC, 1, heal->fd_src,
+                         GF_XATTROP_ADD_ARRAY, xattr, NULL);
+    sys_dict_release(xattr);
+
+    return;
+
+failed:
+    ida_heal_data_finish(heal);
+}
+
+void ida_heal_data_truncated(ida_heal_t * heal)
+{
+    ida_heal_data_clear(heal);
+}
+
+IDA_HEAL_FOP(
+    ida_heal_ftruncate, ftruncate,
+    ida_dispatch_all,
+    ida_default_request_handler,
+    ida_heal_skip_bad,
+    ida_heal_data_truncated
+)
+
+// The last chunk in flight finishes the healing of data once the end of the
+// file has been found. If some chunks have been left as holes or skipped,
+// the healed fragments could be of a different size than the healthy ones,
+// so they are set to the size of the file first.
+static void ida_heal_data_put(ida_heal_t * heal)
+{
+    if ((atomic_dec(&heal->inflight, memory_order_seq_cst) == 1) &&
+        ((heal->flags & (IDA_HEAL_FLAG_EOF | IDA_HEAL_FLAG_ABORT)) ==
+         IDA_HEAL_FLAG_EOF))
+    {
+        if (((heal->flags & (IDA_HEAL_FLAG_SPARSE | IDA_HEAL_FLAG_DIRTY)) !=
+             0) && (heal->bad != 0))
+        {
+            ida_heal_ftruncate(heal, heal->bad, IDA_USE_DFC, 1, heal->fd_dst,
+                               __atomic_load_n(&heal->size, __ATOMIC_ACQUIRE),
+                               NULL);
+        }
+        else
+        {
+            ida_heal_data_clear(heal);
+        }
+    }
+}
+
+// A chunk has been completely processed. Another one is read in its place
+// while there is something to heal.
+static void ida_heal_data_done(ida_heal_t * heal)
+{
+    if (heal->bad != 0)
+    {
+        ida_heal_data_next(heal);
+    }
+
+    ida_heal_data_put(heal);
+}
+
+static bool ida_heal_is_zero(struct iovec * vector, int32_t count,
+                             size_t size)
+{
+    uint8_t * ptr;
+    size_t length;
+    int32_t i;
+
+    for (i = 0; (i < count) && (size > 0); i++)
+    {
+        length = SYS_MIN(vector[i].iov_len, size);
+        ptr = vector[i].iov_base;
+        if ((length > 0) &&
+            ((ptr[0] != 0) || (memcmp(ptr, ptr + 1, length - 1) != 0)))
+        {
+            return false;
+        }
+        size -= length;
+    }
+
+    return true;
+}
+
+// Fragments are linear combinations of the original data, so if all the
+// fragments used to compute the missing ones are null, the missing ones are
+// also null and don't need to be written. The destination starts empty, so
+// the chunk is left as a hole.
+static bool ida_heal_is_hole(ida_heal_t * heal, ida_answer_t * ans,
+                             size_t size)
+{
+    SYS_GF_CBK_CALL_TYPE(readv) * args;
+    ida_private_t * ida;
+    ida_fragment_t * fragment;
+    int32_t i;
+
+    ida = heal->xl->private;
+
+    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+    if (!ida_heal_is_zero(args->vector.iovec, args->vector.count, size))
+    {
+        return false;
+    }
+    for (i = 1, fragment = ans->fragments; i < ida->fragments;
+         i++, fragment = fragment->next)
+    {
+        if (!ida_heal_is_zero(fragment->vector, fragment->count, size))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Computes the fragments of the bad subvolumes directly from the fragments
+// of 'ans', which has been read from the good ones, and sends them. Only the
+// minimum number of fragments is used, and the original data is never
+// rebuilt. 'length' is the number of bytes of the file covered by the
+// fragments, which is smaller than their padded size at the end of the file.
+static bool ida_heal_regenerate(ida_heal_t * heal, ida_answer_t * ans,
+                                size_t size, off_t offset, uint64_t length)
+{
+    SYS_GF_CBK_CALL_TYPE(readv) * args;
+    ida_private_t * ida;
+    ida_fragment_t * fragment;
+    ida_iov_cursor_t cursors[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * ptrs[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * out[IDA_RABIN_MAX_ROWS];
+    uint32_t rows[IDA_RABIN_MAX_COLUMNS];
+    struct iovec * vector;
+    struct iobref * iobref;
+    struct iobuf * iobuf;
+    uint8_t * bounce;
+    dict_t * xdata;
+    size_t max, slice, avail, chunk;
+    uintptr_t targets;
+    int32_t i, j, count, slices;
+
+    ida = heal->xl->private;
+
+    targets = heal->bad;
+    count = sys_bits_count64(targets);
+    if (count == 0)
+    {
+        return false;
+    }
+
+    max = iobpool_default_pagesize(
+                                (struct iobuf_pool *)ida->xl->ctx->iobuf_pool);
+    max -= max % (ida->block_size / ida->fragments);
+    slices = (size + max - 1) / max;
+
+    // Answers and their fragments are kept until the request is destroyed,
+    // so their buffers can be used directly.
+    args = (SYS_GF_CBK_CALL_TYPE(readv) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+    rows[0] = ans->id;
+    ida_iov_cursor_init(&cursors[0], args->vector.iovec, args->vector.count,
+                        0);
+    for (i = 1, fragment = ans->fragments; i < ida->fragments;
+         i++, fragment = fragment->next)
+    {
+        rows[i] = fragment->id;
+        ida_iov_cursor_init(&cursors[i], fragment->vector, fragment->count, 0);
+    }
+
+    SYS_PTR(
+        &iobref, iobref_new, (),
+        ENOMEM,
+        E(),
+        RETVAL(false)
+    );
+
+    bounce = NULL;
+    vector = ida_pool_alloc(sizeof(struct iovec) * count * slices);
+    if (vector == NULL)
+    {
+        goto failed;
+    }
+
+    for (j = 0; j < slices; j++)
+    {
+        slice = size - j * max;
+        if (slice > max)
+        {
+            slice = max;
+        }
+        for (i = 0; i < count; i++)
+        {
+            SYS_PTR(
+                &iobuf, iobuf_get, (ida->xl->ctx->iobuf_pool),
+                ENOMEM,
+                E(),
+                GOTO(failed)
+            );
+            SYS_CODE(
+                iobref_add, (iobref, iobuf),
+                ENOMEM,
+                E(),
+                GOTO(failed_iobuf)
+            );
+
+            vector[i * slices + j].iov_base = iobuf->ptr;
+            vector[i * slices + j].iov_len = slice;
+            out[i] = iobuf->ptr;
+
+            iobuf_unref(iobuf);
+        }
+
+        while (slice > 0)
+        {
+            chunk = slice;
+            for (i = 0; i < ida->fragments; i++)
+            {
+                avail = ida_iov_cursor_contiguous(&cursors[i], &ptrs[i]);
+                if (chunk > avail)
+                {
+                    chunk = avail;
+                }
+            }
+            chunk -= chunk % (IDA_GF_BITS * 16);
+            if (chunk > 0)
+            {
+                for (i = 0; i < ida->fragments; i++)
+                {
+                    ida_iov_cursor_advance(&cursors[i], NULL, chunk);
+                }
+            }
+            else
+            {
+                chunk = slice;
+                if (chunk > IDA_BOUNCE_SIZE)
+                {
+                    chunk = IDA_BOUNCE_SIZE;
+                }
+                // Most chunks are decoded in place, so the bounce buffer is
+                // only allocated when it's needed.
+                if (bounce == NULL)
+                {
+                    bounce = ida_pool_alloc(ida->fragments * IDA_BOUNCE_SIZE);
+                    if (bounce == NULL)
+                    {
+                        logE("Unable to allocate a bounce buffer");
+
+                        goto failed;
+                    }
+                }
+                for (i = 0; i < ida->fragments; i++)
+                {
+                    ptrs[i] = bounce + i * IDA_BOUNCE_SIZE;
+                    ida_iov_cursor_advance(&cursors[i], ptrs[i], chunk);
+                }
+            }
+
+            if (ida_rabin_regenerate(&ida->rabin, chunk, rows, ptrs,
+                                     targets, out) == 0)
+            {
+                logE("Unable to compute healed fragments");
+
+                goto failed;
+            }
+
+            for (i = 0; i < count; i++)
+            {
+                out[i] += chunk;
+            }
+            slice -= chunk;
+        }
+    }
+
+    xdata = NULL;
+    SYS_CALL(
+        sys_dict_set_uint64, (&xdata, DFC_XATTR_SIZE, length, NULL),
+        E(),
+        GOTO(failed)
+    );
+    ida_heal_writev(heal, targets, IDA_USE_DFC, 1, heal->fd_dst, vector,
+                    count * slices, offset, 0, iobref, xdata);
+    sys_dict_release(xdata);
+
+    ida_pool_free(vector);
+    if (bounce != NULL)
+    {
+        ida_pool_free(bounce);
+    }
+    iobref_unref(iobref);
+
+    return true;
+
+failed_iobuf:
+    iobuf_unref(iobuf);
+failed:
+    if (vector != NULL)
+    {
+        ida_pool_free(vector);
+    }
+    if (bounce != NULL)
+    {
+        ida_pool_free(bounce);
+    }
+    iobref_unref(iobref);
+
+    return false;
+}
+
 bool ida_heal_readv_handler(ida_heal_t * heal, ida_request_t * req,
                             uintptr_t * data, err_t error)
 {
     ida_private_t * ida;
     ida_answer_t * ans;
+    SYS_GF_FOP_CALL_TYPE(readv) * fop;
     SYS_GF_CBK_CALL_TYPE(readv) * args;
-    uintptr_t good, bad, mask;
+    uintptr_t bad;
+    uint64_t length;
     off_t offset;
 
     SYS_PTR(
         &ans, ida_heal_check_basic, (heal, req, error, &bad),
         ENODATA,
         E(),
-        RETVAL(false)
+        GOTO(failed)
     );
 
     if (bad != 0)
@@ -374,71 +869,71 @@ bool ida_heal_readv_handler(ida_heal_t * heal, ida_request_t * req,
     {
         ida_heal_show_msg(heal, ans->mask, args->op_errno,
                           "Unable to read healthy data");
+
+        goto failed;
     }
-    else if (args->op_ret > 0)
-    {
-        offset = heal->offset;
-        heal->offset += 128 * 1024;
-        ida_heal_writev(heal, heal->bad, IDA_USE_DFC, 1, heal->fd_dst,
-                        args->vector.iovec, args->vector.count,
-                        offset, 0, args->iobref, NULL);
-    }
-    else
-    {
-        good = heal->good;
-        bad = heal->bad;
 
+    // The size seen by the last read is used to detect the end of the file
+    // and to set the final size of the healed fragments.
+    atomic_xchg(&heal->size, args->stbuf.ia_size, memory_order_seq_cst);
+
+    if (args->op_ret > 0)
+    {
         ida = heal->xl->private;
-        ida_heal_cleanup(heal);
-        heal->mask = good | bad;
-        heal->good = good;
-        heal->bad = bad;
 
-        mask = heal->mask;
-        SYS_CALL(
-            dfc_begin, (ida->dfc, mask, heal->loc.inode, NULL,
-                        &heal->txn),
-            E(),
-            LOG(E(), "Unable to initiate a transaction for healing"),
-            GOTO(failed)
-        );
+        // A short read means that the end of the file has been reached. The
+        // answer contains the length of each fragment.
+        if ((uint64_t)args->op_ret * ida->fragments < ida->heal_chunk_size)
+        {
+            atomic_or(&heal->flags, IDA_HEAL_FLAG_EOF, memory_order_seq_cst);
+        }
 
-        SYS_CALL(
-            dfc_attach, (heal->txn, 0, &heal->xdata),
-            E(),
-            GOTO(failed_dfc)
-        );
+        fop = (SYS_GF_FOP_CALL_TYPE(readv) *)((uintptr_t *)req +
+                                              IDA_REQ_SIZE);
+        offset = fop->offset * ida->fragments + req->data;
 
-        ida_heal_metadata_xattr_get(heal);
+        // The last chunk only covers the file up to its real size.
+        length = (uint64_t)args->op_ret * ida->fragments;
+        if (offset + length > args->stbuf.ia_size)
+        {
+            length = ((uint64_t)offset < args->stbuf.ia_size)
+                     ? args->stbuf.ia_size - offset : 0;
+        }
+        // Healed fragments that keep their previous contents can't be left
+        // as holes.
+        if (((heal->flags & IDA_HEAL_FLAG_DIRTY) == 0) &&
+            ida_heal_is_hole(heal, ans, args->op_ret))
+        {
+            ida_stats_add(&ida->stats, IDA_STATS_HEAL_HOLES,
+                          args->op_ret * ida->fragments);
+            atomic_or(&heal->flags, IDA_HEAL_FLAG_SPARSE,
+                      memory_order_seq_cst);
+            ida_heal_data_done(heal);
+        }
+        else if (!ida_heal_regenerate(heal, ans, args->op_ret, offset,
+                                      length))
+        {
+            goto failed;
+        }
+    }
+    else
+    {
+        atomic_or(&heal->flags, IDA_HEAL_FLAG_EOF, memory_order_seq_cst);
+        ida_heal_data_done(heal);
     }
 
     return false;
 
-failed_dfc:
-    dfc_failed(heal->txn, sys_bits_count64(mask));
 failed:
+    atomic_or(&heal->flags, IDA_HEAL_FLAG_ABORT, memory_order_seq_cst);
+    ida_heal_data_done(heal);
 
     return false;
 }
 
-IDA_HEAL_FOP(
-    ida_heal_readv, readv,
-    ida_dispatch_all,
-    ida_heal_readv_handler,
-    ida_default_answer_handler,
-    ida_default_end_handler
-)
-
 void ida_heal_writev_handler(ida_heal_t * heal)
 {
-    ida_private_t * ida;
-
-    if (heal->bad != 0)
-    {
-        ida = heal->xl->private;
-        ida_heal_readv(heal, heal->good, IDA_USE_DFC, ida->fragments,
-                       heal->fd_src, 128 * 1024, heal->offset, 0, NULL);
-    }
+    ida_heal_data_done(heal);
 }
 
 bool ida_heal_rebuild(ida_heal_t * heal);
@@ -447,7 +942,7 @@ void ida_heal_release(ida_heal_t * heal)
 {
     ida_private_t * ida;
     uintptr_t mask, bad;
-    char buff[64];
+    char buff[65];
 
     if (atomic_dec(&heal->refs, memory_order_seq_cst) == 1)
     {
@@ -467,11 +962,8 @@ void ida_heal_release(ida_heal_t * heal)
             ida = heal->xl->private;
             if ((heal->flags & IDA_HEAL_FLAG_DATA) != 0)
             {
-                logI("HEAL: recovering data"); \
-                heal->flags &= ~IDA_HEAL_FLAG_DATA;
-                ida_heal_readv(heal, heal->good, IDA_USE_DFC, ida->fragments,
-                               heal->fd_src, 128 * 1024, heal->offset, 0,
-                               NULL);
+                logI("HEAL: recovering data");
+                ida_heal_data_start(heal);
                 mask = 0;
             }
             else if (bad != 0)
@@ -574,12 +1066,47 @@ void ida_heal_remove(ida_heal_t * heal, ida_request_t * req)
     } while (item->next != &req->answers);
 }
 
+// If all bad subvolumes still contain the same regular file and the healthy
+// ones have recorded some modification, only the modified regions need to be
+// healed.
+static bool ida_heal_partial(ida_heal_t * heal, ida_request_t * req)
+{
+    struct list_head * item;
+    ida_answer_t * ans;
+    SYS_GF_CBK_CALL_TYPE(lookup) * args;
+
+    if (((heal->flags & IDA_HEAL_FLAG_TRACKED) == 0) ||
+        !ida_dirty_any(heal->dirty))
+    {
+        return false;
+    }
+
+    item = req->answers.next;
+    do
+    {
+        item = item->next;
+        ans = list_entry(item, ida_answer_t, list);
+        args = (SYS_GF_CBK_CALL_TYPE(lookup) *)((uintptr_t *)ans +
+                                                IDA_ANS_SIZE);
+        if ((args->op_ret < 0) ||
+            (heal->iatt.ia_ino != args->buf.ia_ino) ||
+            (heal->iatt.ia_type != args->buf.ia_type) ||
+            (uuid_compare(heal->iatt.ia_gfid, args->buf.ia_gfid) != 0))
+        {
+            return false;
+        }
+    } while (item->next != &req->answers);
+
+    return true;
+}
+
 void ida_heal_prepare(ida_heal_t * heal, ida_request_t * req)
 {
     ida_private_t * ida;
     struct list_head * item;
     ida_answer_t * ans;
     SYS_GF_CBK_CALL_TYPE(lookup) * args;
+    bool partial;
     char txt1[65], txt2[65];
 
     ida = heal->xl->private;
@@ -588,6 +1115,12 @@ void ida_heal_prepare(ida_heal_t * heal, ida_request_t * req)
                       to_bin(txt1, sizeof(txt1), heal->good, ida->nodes),
                       to_bin(txt2, sizeof(txt2), heal->bad, ida->nodes));
 
+    partial = ida_heal_partial(heal, req);
+    if (partial)
+    {
+        atomic_or(&heal->flags, IDA_HEAL_FLAG_DIRTY, memory_order_seq_cst);
+    }
+
     item = req->answers.next;
     do
     {
@@ -599,7 +1132,8 @@ void ida_heal_prepare(ida_heal_t * heal, ida_request_t * req)
             (heal->iatt.ia_ino != args->buf.ia_ino) ||
             (heal->iatt.ia_type != args->buf.ia_type) ||
             (heal->iatt.ia_size != args->buf.ia_size) ||
-            (uuid_compare(heal->iatt.ia_gfid, args->buf.ia_gfid) != 0))
+            (uuid_compare(heal->iatt.ia_gfid, args->buf.ia_gfid) != 0) ||
+            partial)
         {
             ida_heal_show_msg(heal, ans->mask, 0, "Needs data heal");
 
@@ -628,8 +1162,16 @@ void ida_heal_prepare(ida_heal_t * heal, ida_request_t * req)
                 else
                 {
                     atomic_or(&heal->open, ans->mask, memory_order_seq_cst);
-                    ida_heal_truncate(heal, ans->mask, IDA_USE_DFC, 1,
-                                      &heal->loc, 0, heal->xdata);
+                    if (partial)
+                    {
+                        ida_heal_show_msg(heal, ans->mask, 0,
+                                          "Only modified regions are healed");
+                    }
+                    else
+                    {
+                        ida_heal_truncate(heal, ans->mask, IDA_USE_DFC, 1,
+                                          &heal->loc, 0, heal->xdata);
+                    }
                 }
             }
         }
@@ -726,6 +1268,11 @@ bool ida_heal_check_state(ida_heal_t * heal, ida_request_t * req,
     else
     {
         sys_iatt_acquire(&heal->iatt, &args->buf);
+        if ((args->buf.ia_type == IA_IFREG) &&
+            ida_dirty_get(args->xdata, heal->dirty))
+        {
+            heal->flags |= IDA_HEAL_FLAG_TRACKED;
+        }
         if (args->buf.ia_type == IA_IFLNK)
         {
             ida_heal_readlink(heal, heal->good, IDA_USE_DFC, 1, &heal->loc,
@@ -1152,6 +1699,7 @@ SYS_ASYNC_DEFINE(ida_heal_start, ((ida_heal_t *, heal)))
 {
     xlator_t * xl;
     ida_private_t * ida;
+    dict_t * xdata;
     err_t error;
 
     xl = heal->xl;
@@ -1174,11 +1722,37 @@ SYS_ASYNC_DEFINE(ida_heal_start, ((ida_heal_t *, heal)))
         GOTO(failed, &error)
     );
 
+    // Only the lookup needs the recorded modifications. The dictionary is
+    // also used to create missing inodes.
+    xdata = NULL;
+    if ((ida->dirty_size > 0) && (heal->xdata != NULL))
+    {
+        SYS_PTR(
+            &xdata, dict_copy, (heal->xdata, NULL),
+            ENOMEM,
+            E(),
+            GOTO(failed, &error)
+        );
+        dict_ref(xdata);
+        SYS_CALL(
+            sys_dict_set_uint64, (&xdata, IDA_KEY_DIRTY, 0, NULL),
+            E(),
+            GOTO(failed_xdata, &error)
+        );
+    }
+
     ida_heal_lookup_start(heal, heal->mask, IDA_USE_DFC, ida->fragments,
-                          &heal->loc, heal->xdata);
+                          &heal->loc, (xdata != NULL) ? xdata : heal->xdata);
+
+    if (xdata != NULL)
+    {
+        sys_dict_release(xdata);
+    }
 
     return;
 
+failed_xdata:
+    sys_dict_release(xdata);
 failed:
     dfc_failed(heal->txn, sys_bits_count64(heal->mask));
 
@@ -1219,18 +1793,23 @@ void ida_heal_loc(xlator_t * xl, loc_t * loc)
         ida = xl->private;
         heal->available = ida->xl_up;
 
+        // The counter must be incremented before the heal is visible, so
+        // that fops never skip the inode context while it's present.
+        atomic_inc(&ida->healing, memory_order_seq_cst);
+
         value = (uint64_t)(uintptr_t)heal;
         SYS_CODE(
             __inode_ctx_set, (inode, xl, &value),
             ENOMEM,
             E(),
             LOG(E(), "Unable to store healing information in inode context"),
-            GOTO(failed_frame)
+            GOTO(failed_healing)
         );
 
         UNLOCK(&inode->lock);
 
         logI("Initiating self-heal");
+        ida_stats_add(&ida->stats, IDA_STATS_HEALS_STARTED, 1);
 
         SYS_ASYNC(ida_heal_start, (heal));
     }
@@ -1241,7 +1820,8 @@ void ida_heal_loc(xlator_t * xl, loc_t * loc)
 
     return;
 
-failed_frame:
+failed_healing:
+    atomic_dec(&ida->healing, memory_order_seq_cst);
     STACK_DESTROY(heal->frame->root);
 failed_heal:
     sys_loc_release(&heal->loc);
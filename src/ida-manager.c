@@ -20,17 +20,76 @@
 
 #include "gfsys.h"
 
+#include <fcntl.h>
+
 #include "ida-common.h"
 #include "ida-type-dict.h"
 #include "ida-manager.h"
 #include "ida-rabin.h"
 #include "ida-mem-types.h"
 #include "ida-heal.h"
+#include "ida-pool.h"
+#include "ida-dirty.h"
 #include "ida.h"
 
+// Keeps references to the buffers of the answer of a subvolume. Only the
+// iovecs are copied.
+bool ida_fragment_add(ida_answer_t * ans, int32_t id, struct iovec * vector,
+                      int32_t count, struct iobref * iobref, data_t * data)
+{
+    ida_fragment_t * fragment;
+
+    SYS_PTR(
+        &fragment, ida_pool_alloc,
+        (sizeof(ida_fragment_t) + count * sizeof(struct iovec)),
+        ENOMEM,
+        E(),
+        RETVAL(false)
+    );
+    fragment->id = id;
+    fragment->count = count;
+    if (count > 0)
+    {
+        memcpy(fragment->vector, vector, count * sizeof(struct iovec));
+    }
+    fragment->iobref = (iobref != NULL) ? iobref_ref(iobref) : NULL;
+    fragment->data = (data != NULL) ? data_ref(data) : NULL;
+
+    fragment->next = ans->fragments;
+    ans->fragments = fragment;
+
+    return true;
+}
+
+static void ida_fragment_destroy(ida_fragment_t * fragment)
+{
+    if (fragment->iobref != NULL)
+    {
+        iobref_unref(fragment->iobref);
+    }
+    if (fragment->data != NULL)
+    {
+        data_unref(fragment->data);
+    }
+    ida_pool_free(fragment);
+}
+
+static void ida_answer_release(ida_answer_t * ans)
+{
+    if (atomic_dec(&ans->refs, memory_order_seq_cst) == 1)
+    {
+        sys_gf_args_free((uintptr_t *)ans);
+    }
+}
+
 void ida_request_destroy(ida_request_t * req)
 {
-    ida_answer_t * ans, * tmp, * next;
+    ida_private_t * ida;
+    ida_answer_t * ans, * tmp;
+    ida_fragment_t * fragment;
+
+    ida = req->xl->private;
+    IDA_TRACE(ida, req, DESTROY, -1, 0);
 
     STACK_DESTROY(req->rframe->root);
 
@@ -41,26 +100,97 @@ void ida_request_destroy(ida_request_t * req)
     list_for_each_entry_safe(ans, tmp, &req->answers, list)
     {
         list_del_init(&ans->list);
-        while (ans->next != NULL)
+        while (ans->fragments != NULL)
         {
-            next = ans->next;
-            ans->next = next->next;
-            sys_gf_args_free((uintptr_t *)next);
+            fragment = ans->fragments;
+            ans->fragments = fragment->next;
+            ida_fragment_destroy(fragment);
         }
-        sys_gf_args_free((uintptr_t *)ans);
+        ida_answer_release(ans);
     }
 
     sys_gf_args_free((uintptr_t *)req);
 }
 
-void ida_complete(ida_request_t * req)
+static void ida_complete_finish(ida_request_t * req, ida_answer_t * ans)
 {
+    SYS_GF_CBK_CALL_TYPE(access) * args;
     ida_private_t * ida;
-    ida_answer_t * ans;
     uintptr_t mask;
-    err_t error;
+    bool valid;
+
+    // Blocks written by this request are only usable if it succeeded.
+    ida = req->xl->private;
+    args = (SYS_GF_CBK_CALL_TYPE(access) *)((uintptr_t *)ans + IDA_ANS_SIZE);
+    valid = (ans->count >= req->minimum) && (args->op_ret >= 0);
+    ida_cache_release(&ida->cache, &req->cached[0], valid);
+    ida_cache_release(&ida->cache, &req->cached[1], valid);
+    ida_cache_unblock(&ida->cache, req->barrier);
+
+    ida_dirty_unmark(ida, req, ans);
+
+    mask = req->sent & ~ans->mask;
+    if (mask != 0)
+    {
+        IDA_TRACE(ida, req, HEAL, -1, __builtin_popcountll(mask));
+        ida_heal(req->xl, &req->loc1, &req->loc2, req->fd);
+    }
+
+    ida_request_destroy(req);
+}
+
+// Accounts the request in the statistics and reports its result to the
+// caller.
+static void ida_completed(ida_request_t * req, err_t error, uintptr_t * data)
+{
+    SYS_GF_CBK_CALL_TYPE(access) * args;
+    ida_private_t * ida;
+    uint64_t bytes;
+    bool failed;
+
+    ida = req->xl->private;
+
+    bytes = 0;
+    failed = (error != 0);
+    if (!failed)
+    {
+        args = (SYS_GF_CBK_CALL_TYPE(access) *)data;
+        failed = (args->op_ret < 0);
+        if (!failed && ((req->fop == IDA_FOP_ID_readv) ||
+                        (req->fop == IDA_FOP_ID_writev)))
+        {
+            bytes = args->op_ret;
+        }
+    }
+    ida_stats_fop(&ida->stats, req->fop, ida_time_now() - req->started,
+                  failed, bytes);
+    IDA_TRACE(ida, req, UNWIND, -1, error);
+
+    req->handlers->completed(req->frame, error, req, data);
+}
+
+static void ida_complete_rebuilt(ida_request_t * req, ida_answer_t * ans,
+                                 int32_t result)
+{
+    ida_private_t * ida;
+
+    ida = req->xl->private;
+    IDA_TRACE(ida, req, REBUILT, -1, result);
+
+    ida_completed(req, (result >= 0) ? 0 : EIO,
+                  (uintptr_t *)ans + IDA_ANS_SIZE);
+
+    ida_complete_finish(req, ans);
+}
+
+// Releases one of the pending references of the request. It's also used to
+// release references that do not correspond to a request sent to a subvolume.
+static void ida_release(ida_request_t * req)
+{
+    ida_private_t * ida;
+    ida_answer_t * ans;
+    int32_t ret;
 
-    dfc_complete(req->txn);
     if (atomic_dec(&req->pending, memory_order_seq_cst) == 1)
     {
         ans = list_entry(req->answers.next, ida_answer_t, list);
@@ -68,41 +198,243 @@ void ida_complete(ida_request_t * req)
         {
             req->completed = 1;
             ida = req->xl->private;
-            error = EIO;
+            ret = -1;
             if (ans->count >= req->minimum)
             {
-                if (req->handlers->rebuild(ida, req, ans) >= 0)
+                req->rebuilt = ida_complete_rebuilt;
+                ret = req->handlers->rebuild(ida, req, ans);
+                if (ret == IDA_REBUILD_ASYNC)
                 {
-                    error = 0;
+                    return;
                 }
             }
 
-            req->handlers->completed(req->frame, error, req,
-                                     (uintptr_t *)ans + IDA_ANS_SIZE);
-        }
+            ida_complete_rebuilt(req, ans, ret);
 
-        mask = req->sent & ~ans->mask;
-        if (mask != 0)
-        {
-            ida_heal(req->xl, &req->loc1, &req->loc2, req->fd);
+            return;
         }
 
-        ida_request_destroy(req);
+        ida_complete_finish(req, ans);
     }
 }
 
+void ida_complete(ida_request_t * req)
+{
+    dfc_complete(req->txn);
+    ida_release(req);
+}
+
+void ida_rebuild_done(ida_request_t * req, ida_answer_t * ans, int32_t result)
+{
+    req->rebuilt(req, ans, result);
+}
+
 void ida_unwind(ida_request_t * req, err_t error, uintptr_t * data)
 {
     if (atomic_xchg(&req->completed, 1, memory_order_seq_cst) == 0)
     {
-        req->handlers->completed(req->frame, error, req, data);
+        ida_completed(req, error, data);
+    }
+}
+
+static void ida_dispatch_rebuilt(ida_request_t * req, ida_answer_t * final,
+                                 int32_t result)
+{
+    ida_private_t * ida;
+
+    ida = req->xl->private;
+    IDA_TRACE(ida, req, REBUILT, -1, result);
+
+    if (result >= 0)
+    {
+        ida_unwind(req, 0, (uintptr_t *)final + IDA_ANS_SIZE);
+    }
+    else
+    {
+        logE("IDA: rebuild failed");
+        ida_unwind(req, EIO, (uintptr_t *)final + IDA_ANS_SIZE);
+    }
+    ida_answer_release(final);
+
+    ida_complete(req);
+}
+
+// A request waiting to be sent to a subvolume that already has the maximum
+// number of pending requests. Writes send a different fragment to each
+// subvolume, so the vector is kept here.
+typedef struct
+{
+    struct list_head list;
+    ida_request_t *  req;
+    int32_t          idx;
+    int32_t          count;
+    off_t            offset;
+    struct iobref *  iobref;
+    struct iovec     vector[];
+} ida_wind_t;
+
+static void ida_child_send(ida_private_t * ida, ida_request_t * req,
+                           int32_t idx, struct iovec * vector, int32_t count,
+                           off_t offset, struct iobref * iobref);
+
+static void ida_child_answered(ida_private_t * ida, int32_t idx,
+                               uint64_t start, int32_t op_ret)
+{
+    ida_child_t * child;
+    ida_wind_t * wind;
+    uint64_t elapsed, average, error;
+
+    child = &ida->childs[idx];
+
+    // The slot of the answered request is directly given to the oldest
+    // queued request, if any.
+    wind = NULL;
+    if (ida->queue_depth > 0)
+    {
+        LOCK(&child->lock);
+
+        if (!list_empty(&child->queue))
+        {
+            wind = list_entry(child->queue.next, ida_wind_t, list);
+            list_del_init(&wind->list);
+            child->queued--;
+        }
+        else
+        {
+            atomic_dec(&child->inflight, memory_order_seq_cst);
+        }
+
+        UNLOCK(&child->lock);
+    }
+    else
+    {
+        atomic_dec(&child->inflight, memory_order_seq_cst);
+    }
+
+    elapsed = ida_time_now() - start;
+    ida_stats_child(&ida->stats, idx, elapsed, op_ret < 0);
+
+    // Failed requests can be answered much faster than normal ones, so they
+    // are not taken into account for the latency.
+    if (op_ret >= 0)
+    {
+        // This is not thread-safe, but the latency is only used to balance
+        // requests. If some sample is lost, it's not a problem.
+        if (child->latency == 0)
+        {
+            child->latency = elapsed << IDA_LATENCY_SHIFT;
+            child->deviation = elapsed << (IDA_DEVIATION_SHIFT - 1);
+        }
+        else
+        {
+            average = child->latency >> IDA_LATENCY_SHIFT;
+            error = (elapsed > average) ? elapsed - average
+                                        : average - elapsed;
+            child->latency += elapsed - average;
+            child->deviation += error -
+                                (child->deviation >> IDA_DEVIATION_SHIFT);
+        }
+    }
+
+    if (wind != NULL)
+    {
+        ida_child_send(ida, wind->req, idx,
+                       (wind->iobref != NULL) ? wind->vector : NULL,
+                       wind->count, wind->offset, wind->iobref);
+        if (wind->iobref != NULL)
+        {
+            iobref_unref(wind->iobref);
+        }
+        ida_pool_free(wind);
+    }
+}
+
+// Expected time to get an answer from a subvolume if a new request is sent to
+// it now.
+static uint64_t ida_child_cost(ida_private_t * ida, int32_t idx)
+{
+    ida_child_t * child;
+    uint64_t cost;
+
+    child = &ida->childs[idx];
+
+    cost = ((child->latency >> IDA_LATENCY_SHIFT) + 1) *
+           (child->inflight + child->queued + 1);
+
+    // Subvolumes that cannot accept more requests are only used when there
+    // are no other alternatives.
+    if ((ida->queue_depth > 0) && (child->inflight >= ida->queue_depth))
+    {
+        cost += IDA_CHILD_SATURATED;
+    }
+
+    return cost;
+}
+
+// Time, in microseconds, after which the answer of a subvolume is considered
+// late. Answer times are assumed to be rarely bigger than the average plus
+// four times the mean deviation. It returns 0 if some of the subvolumes has
+// not answered any request yet.
+static uint64_t ida_child_deadline(ida_private_t * ida, uintptr_t mask)
+{
+    ida_child_t * child;
+    uint64_t deadline, time;
+    int32_t idx;
+
+    deadline = 0;
+    while (mask != 0)
+    {
+        idx = sys_bits_first_one_index64(mask);
+        mask ^= 1ULL << idx;
+
+        child = &ida->childs[idx];
+        if (child->latency == 0)
+        {
+            return 0;
+        }
+        time = (child->latency >> IDA_LATENCY_SHIFT) + child->deviation;
+        if (deadline < time)
+        {
+            deadline = time;
+        }
+    }
+
+    return deadline;
+}
+
+// The hedge of a request is no longer needed. The subvolume reserved for it
+// in the transaction is released, the timer is cancelled and its pending
+// reference dropped. The caller must hold another reference.
+static void ida_dispatch_hedge_cancel(ida_request_t * req)
+{
+    uintptr_t delay;
+
+    if (atomic_xchg(&req->hedge, IDA_HEDGE_DONE,
+                    memory_order_seq_cst) == IDA_HEDGE_ARMED)
+    {
+        dfc_failed(req->txn, 1);
+
+        // If the timer has already fired, it will find the hedge done.
+        delay = atomic_xchg(&req->hedge_delay, IDA_HEDGE_FIRED,
+                            memory_order_seq_cst);
+        if ((delay != 0) && (delay != IDA_HEDGE_FIRED))
+        {
+            sys_delay_cancel((uintptr_t *)delay, false);
+        }
+
+        ida_release(req);
     }
 }
 
+// Answers are still combined under the lock of the request, but the
+// fingerprint of each answer is computed before taking it, so that the
+// combine inside it is cheaper: only answers with the same error code, xdata
+// and main iatt are compared.
 SYS_LOCK_CREATE(__ida_dispatch_cbk, ((uintptr_t *, io),
                                      (ida_private_t *, ida),
                                      (ida_request_t *, req),
-                                     (uint32_t, id)))
+                                     (uint32_t, id),
+                                     (uint64_t, fingerprint)))
 {
     ida_answer_t * ans, * tmp, * final;
     struct list_head * item;
@@ -110,6 +442,10 @@ SYS_LOCK_CREATE(__ida_dispatch_cbk, ((uintptr_t *, io),
 
     list_for_each_entry(ans, &req->answers, list)
     {
+        if (ans->fingerprint != fingerprint)
+        {
+            continue;
+        }
         if (req->handlers->combine(req, id, ans, io))
         {
             ans->count++;
@@ -140,23 +476,40 @@ SYS_LOCK_CREATE(__ida_dispatch_cbk, ((uintptr_t *, io),
     ans->count = 1;
     ans->mask = 1ULL << id;
     ans->id = id;
-    ans->next = NULL;
+    ans->fingerprint = fingerprint;
+    ans->refs = 1;
+    ans->fragments = NULL;
     list_add_tail(&ans->list, &req->answers);
 
 merged:
     final = NULL;
     if (ans->count == req->required)
     {
-        final = req->handlers->copy((uintptr_t *)ans + IDA_ANS_SIZE);
-        final->count = ans->count;
-        final->mask = ans->mask;
-        final->id = ans->id;
-        final->next = ans->next;
+        // If no other answer can be received, nothing else will modify the
+        // answer, so it can be rebuilt in place. Otherwise a copy is rebuilt.
+        // Fragments are owned by the original answer in both cases.
+        if (req->pending == 1)
+        {
+            final = ans;
+            atomic_inc(&final->refs, memory_order_seq_cst);
+        }
+        else
+        {
+            final = req->handlers->copy((uintptr_t *)ans + IDA_ANS_SIZE);
+            final->count = ans->count;
+            final->mask = ans->mask;
+            final->id = ans->id;
+            final->fingerprint = ans->fingerprint;
+            final->refs = 1;
+            final->fragments = ans->fragments;
+        }
     }
 
+    // The timer of an armed hedge holds a pending reference, but it's not an
+    // answer that can arrive.
     tmp = list_entry(req->answers.next, ida_answer_t, list);
     needed = SYS_MIN(req->required, req->minimum) - tmp->count -
-             req->pending + 1;
+             req->pending + 1 + (req->hedge == IDA_HEDGE_ARMED);
     if (needed > 0)
     {
         req->failed |= req->last_sent & ~ tmp->mask;
@@ -170,17 +523,17 @@ merged:
     }
     else if (final != NULL)
     {
+        IDA_TRACE(ida, req, QUORUM, -1, final->count);
+        ida_dispatch_hedge_cancel(req);
+
+        req->rebuilt = ida_dispatch_rebuilt;
         ret = req->handlers->rebuild(ida, req, final);
-        if (ret >= 0)
-        {
-            ida_unwind(req, 0, (uintptr_t *)final + IDA_ANS_SIZE);
-        }
-        else
+        if (ret != IDA_REBUILD_ASYNC)
         {
-            logE("IDA: rebuild failed");
-            ida_unwind(req, EIO, (uintptr_t *)final + IDA_ANS_SIZE);
+            ida_dispatch_rebuilt(req, final, ret);
         }
-        sys_gf_args_free((uintptr_t *)final);
+
+        return;
     }
 
     ida_complete(req);
@@ -188,14 +541,41 @@ merged:
 
 SYS_CBK_CREATE(ida_dispatch_cbk, io, ((ida_private_t *, ida),
                                       (ida_request_t *, req),
-                                      (uint32_t, id)))
+                                      (uint32_t, id),
+                                      (uint64_t, start)))
 {
     SYS_GF_WIND_CBK_TYPE(access) * args;
 
     args = (SYS_GF_WIND_CBK_TYPE(access) *)io;
+    IDA_TRACE(ida, req, ANSWER, id, (args->op_ret < 0) ? args->op_errno : 0);
+    ida_child_answered(ida, id, start, args->op_ret);
+    if ((args->op_ret >= 0) || (args->op_errno != EUCLEAN))
+    {
+        SYS_LOCK(&req->lock, __ida_dispatch_cbk,
+                 (io, ida, req, id, req->handlers->fingerprint(io)));
+    }
+    else
+    {
+        req->handlers->dispatch(ida, req);
+
+        ida_complete(req);
+    }
+}
+
+SYS_CBK_CREATE(ida_dispatch_write_cbk, io, ((ida_private_t *, ida),
+                                            (ida_request_t *, req),
+                                            (uint32_t, id),
+                                            (uint64_t, start)))
+{
+    SYS_GF_WIND_CBK_TYPE(writev) * args;
+
+    args = (SYS_GF_WIND_CBK_TYPE(writev) *)io;
+    IDA_TRACE(ida, req, ANSWER, id, (args->op_ret < 0) ? args->op_errno : 0);
+    ida_child_answered(ida, id, start, args->op_ret);
     if ((args->op_ret >= 0) || (args->op_errno != EUCLEAN))
     {
-        SYS_LOCK(&req->lock, __ida_dispatch_cbk, (io, ida, req, id));
+        SYS_LOCK(&req->lock, __ida_dispatch_cbk,
+                 (io, ida, req, id, req->handlers->fingerprint(io)));
     }
     else
     {
@@ -205,46 +585,264 @@ SYS_CBK_CREATE(ida_dispatch_cbk, io, ((ida_private_t *, ida),
     }
 }
 
+static void ida_child_send(ida_private_t * ida, ida_request_t * req,
+                           int32_t idx, struct iovec * vector, int32_t count,
+                           off_t offset, struct iobref * iobref)
+{
+    SYS_GF_FOP_CALL_TYPE(writev) * args;
+    uint64_t start;
+
+    start = ida_time_now();
+    IDA_TRACE(ida, req, SEND, idx, 0);
+    if (vector == NULL)
+    {
+        sys_gf_wind(req->rframe, NULL, ida->xl_list[idx],
+                    SYS_CBK(ida_dispatch_cbk, (ida, req, idx, start)),
+                    NULL, (uintptr_t *)req, (uintptr_t *)req + IDA_REQ_SIZE);
+    }
+    else
+    {
+        args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req +
+                                                IDA_REQ_SIZE);
+        SYS_IO(sys_gf_writev_wind, (req->rframe, NULL, ida->xl_list[idx],
+                                    args->fd, vector, count, offset,
+                                    args->flags, iobref, *req->xdata),
+               SYS_CBK(ida_dispatch_write_cbk, (ida, req, idx, start)));
+    }
+}
+
+static ida_wind_t * ida_child_park(ida_request_t * req, int32_t idx,
+                                   struct iovec * vector, int32_t count,
+                                   off_t offset, struct iobref * iobref)
+{
+    ida_wind_t * wind;
+
+    SYS_PTR(
+        &wind, ida_pool_alloc,
+        (sizeof(ida_wind_t) +
+         ((vector != NULL) ? count * sizeof(struct iovec) : 0)),
+        ENOMEM,
+        E(),
+        RETVAL(NULL)
+    );
+    wind->req = req;
+    wind->idx = idx;
+    wind->count = count;
+    wind->offset = offset;
+    wind->iobref = NULL;
+    if (vector != NULL)
+    {
+        memcpy(wind->vector, vector, count * sizeof(struct iovec));
+        wind->iobref = iobref_ref(iobref);
+    }
+
+    return wind;
+}
+
+// Sends the request to a subvolume, or queues it if the subvolume already has
+// the maximum number of pending requests. 'vector', 'count', 'offset' and
+// 'iobref' are only used by writes.
+static void ida_child_wind(ida_private_t * ida, ida_request_t * req,
+                           int32_t idx, struct iovec * vector, int32_t count,
+                           off_t offset, struct iobref * iobref)
+{
+    ida_child_t * child;
+    ida_wind_t * wind;
+
+    child = &ida->childs[idx];
+
+    if (ida->queue_depth > 0)
+    {
+        LOCK(&child->lock);
+
+        if (child->inflight >= ida->queue_depth)
+        {
+            // If the request cannot be queued, it's sent anyway.
+            wind = ida_child_park(req, idx, vector, count, offset, iobref);
+            if (wind != NULL)
+            {
+                list_add_tail(&wind->list, &child->queue);
+                child->queued++;
+                child->parked++;
+                IDA_TRACE(ida, req, QUEUE, idx, child->queued);
+
+                UNLOCK(&child->lock);
+
+                return;
+            }
+        }
+        atomic_inc(&child->inflight, memory_order_seq_cst);
+
+        UNLOCK(&child->lock);
+    }
+    else
+    {
+        atomic_inc(&child->inflight, memory_order_seq_cst);
+    }
+
+    ida_child_send(ida, req, idx, vector, count, offset, iobref);
+}
+
+// Chooses up to 'count' subvolumes from 'mask'. The ones with the lowest
+// expected answer time, based on their average latency and on the number of
+// requests still pending on them, are preferred. Subvolumes whose costs differ
+// by less than 1/8 are considered equivalent and chosen in a round-robin way.
 int32_t ida_get_childs(ida_private_t * ida, int32_t count, uintptr_t * mask)
 {
-    int32_t first, idx, num;
-    uintptr_t map1, map2;
+    uint64_t costs[IDA_RABIN_MAX_ROWS];
+    uint64_t best_cost;
+    uintptr_t avail, selected;
+    int32_t first, idx, best, i, num;
 
     // This is not thread-safe, but its only purpose is to balance requests.
     // If we lose some increments, it's not a problem.
     idx = first = ida->index;
-    if (++first >= ida->nodes)
+    if (++idx >= ida->nodes)
     {
-        first = 0;
+        idx = 0;
     }
-    ida->index = first;
-    map2 = *mask;
-    map1 = map2 & ((1ULL << idx) - 1ULL);
-    num = sys_bits_count64(map1);
-    if (count <= num)
+    ida->index = idx;
+
+    avail = *mask;
+    for (i = 0; i < ida->nodes; i++)
     {
-        map2 = 0;
-        while (count < num)
+        if ((avail & (1ULL << i)) != 0)
         {
-            map1 ^= sys_bits_first_one_mask64(map1);
-            num--;
+            costs[i] = ida_child_cost(ida, i);
         }
     }
-    else
+
+    selected = 0;
+    for (num = 0; (num < count) && (avail != 0); num++)
     {
-        map2 &= ~((1ULL << idx) - 1ULL);
-        num += sys_bits_count64(map2);
-        while (count < num)
+        best = -1;
+        best_cost = 0;
+        idx = first;
+        for (i = 0; i < ida->nodes; i++)
         {
-            map2 ^= sys_bits_first_one_mask64(map2);
-            num--;
+            if (((avail & (1ULL << idx)) != 0) &&
+                ((best < 0) || (costs[idx] + (costs[idx] >> 3) < best_cost)))
+            {
+                best = idx;
+                best_cost = costs[idx];
+            }
+            if (++idx >= ida->nodes)
+            {
+                idx = 0;
+            }
         }
+        avail ^= 1ULL << best;
+        selected |= 1ULL << best;
     }
-    *mask = map1 | map2;
+    *mask = selected;
 
     return num;
 }
 
+// Executed when the answers of a request have not arrived before the
+// deadline. The request is sent to the reserved subvolume, and the first
+// answers that reach the minimum will be used.
+SYS_DELAY_CREATE(ida_dispatch_hedge, ((ida_request_t *, req)))
+{
+    ida_private_t * ida;
+    uintptr_t delay;
+    int32_t idx;
+
+    ida = req->xl->private;
+
+    delay = atomic_xchg(&req->hedge_delay, IDA_HEDGE_FIRED,
+                        memory_order_seq_cst);
+    if ((delay != 0) && (delay != IDA_HEDGE_FIRED))
+    {
+        sys_delay_release((uintptr_t *)delay);
+    }
+
+    // A cancelled hedge has already dropped the reference of the timer.
+
+    if (atomic_xchg(&req->hedge, IDA_HEDGE_DONE,
+                    memory_order_seq_cst) == IDA_HEDGE_ARMED)
+    {
+        idx = req->hedge_idx;
+        if ((req->completed == 0) && ((ida->xl_up & (1ULL << idx)) != 0))
+        {
+            SYS_CALL(
+                dfc_attach, (req->txn, idx, req->xdata),
+                E(),
+                GOTO(failed)
+            );
+
+            atomic_or(&req->sent, 1ULL << idx, memory_order_seq_cst);
+            IDA_TRACE(ida, req, HEDGE, idx, 0);
+            ida_child_wind(ida, req, idx, NULL, 0, 0, NULL);
+
+            return;
+        }
+
+    failed:
+        dfc_failed(req->txn, 1);
+        ida_release(req);
+    }
+}
+
+// Reserves a subvolume not included in 'mask' to send the request to it if
+// the answers are late. It returns the mask of subvolumes to include in the
+// transaction.
+static uintptr_t ida_dispatch_hedge_prepare(ida_private_t * ida,
+                                            ida_request_t * req,
+                                            uintptr_t mask)
+{
+    uintptr_t spare;
+
+    if (!ida->hedging || (req->sent != 0))
+    {
+        return mask;
+    }
+
+    spare = ida->xl_up & ~req->failed & ~req->bad & ~mask;
+    if ((ida_get_childs(ida, 1, &spare) == 0) ||
+        (ida_child_deadline(ida, mask) == 0))
+    {
+        return mask;
+    }
+
+    req->hedge_idx = sys_bits_first_one_index64(spare);
+    req->hedge = IDA_HEDGE_ARMED;
+
+    return mask | spare;
+}
+
+// Starts the timer of the hedge. It must be called before sending the
+// request to any subvolume. The timer keeps a pending reference to the
+// request.
+static void ida_dispatch_hedge_start(ida_private_t * ida, ida_request_t * req,
+                                     uintptr_t mask)
+{
+    uintptr_t delay;
+    uint64_t deadline;
+
+    if (req->hedge != IDA_HEDGE_ARMED)
+    {
+        return;
+    }
+
+    atomic_inc(&req->pending, memory_order_seq_cst);
+
+    deadline = ida_child_deadline(ida, mask);
+    delay = (uintptr_t)SYS_DELAY((deadline + 999) / 1000, ida_dispatch_hedge,
+                                 (req), 1);
+    if (delay == 0)
+    {
+        ida_dispatch_hedge_cancel(req);
+
+        return;
+    }
+    if (atomic_xchg(&req->hedge_delay, delay,
+                    memory_order_seq_cst) == IDA_HEDGE_FIRED)
+    {
+        sys_delay_release((uintptr_t *)delay);
+    }
+}
+
 void ida_dispatch_incremental(ida_private_t * ida, ida_request_t * req)
 {
     uintptr_t mask;
@@ -272,9 +870,7 @@ void ida_dispatch_incremental(ida_private_t * ida, ida_request_t * req)
         );
 
         atomic_inc(&req->pending, memory_order_seq_cst);
-        sys_gf_wind(req->rframe, NULL, ida->xl_list[idx],
-                    SYS_CBK(ida_dispatch_cbk, (ida, req, idx)),
-                    NULL, (uintptr_t *)req, (uintptr_t *)req + IDA_REQ_SIZE);
+        ida_child_wind(ida, req, idx, NULL, 0, 0, NULL);
 
         return;
     }
@@ -305,7 +901,7 @@ void ida_dispatch_all(ida_private_t * ida, ida_request_t * req)
             SYS_CALL(
                 dfc_begin, (ida->dfc, mask, NULL, *req->xdata, &req->txn),
                 E(),
-                GOTO(failed)
+                GOTO(failed_dirty)
             );
         }
         atomic_add(&req->pending, count, memory_order_seq_cst);
@@ -320,10 +916,7 @@ void ida_dispatch_all(ida_private_t * ida, ida_request_t * req)
                 CONTINUE()
             );
             count--;
-            sys_gf_wind(req->rframe, NULL, ida->xl_list[idx],
-                        SYS_CBK(ida_dispatch_cbk, (ida, req, idx)),
-                        NULL, (uintptr_t *)req,
-                        (uintptr_t *)req + IDA_REQ_SIZE);
+            ida_child_wind(ida, req, idx, NULL, 0, 0, NULL);
         } while (mask != 0);
         if (count > 0)
         {
@@ -335,19 +928,46 @@ void ida_dispatch_all(ida_private_t * ida, ida_request_t * req)
 
     logE("IDA: dispatch to all failed");
 
+failed_dirty:
+    ida_dirty_cancel(req);
+failed:
     ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
+}
 
-    return;
+// Truncates can modify any region of the file.
+void ida_dispatch_truncate(ida_private_t * ida, ida_request_t * req)
+{
+    if (!ida_dirty_mark(ida, req, 0, IDA_DIRTY_ALL, ida_dispatch_truncate))
+    {
+        ida_dispatch_all(ida, req);
+    }
+}
 
-failed:
-    ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
+void ida_dispatch_open(ida_private_t * ida, ida_request_t * req)
+{
+    SYS_GF_FOP_CALL_TYPE(open) * args;
+
+    args = (SYS_GF_FOP_CALL_TYPE(open) *)((uintptr_t *)req + IDA_REQ_SIZE);
+    if ((args->flags & O_TRUNC) != 0)
+    {
+        ida_dispatch_truncate(ida, req);
+    }
+    else
+    {
+        ida_dispatch_all(ida, req);
+    }
 }
 
 void ida_dispatch_minimum(ida_private_t * ida, ida_request_t * req)
 {
-    uintptr_t mask;
+    uintptr_t mask, preferred;
     int32_t idx, i, count;
 
+    if (req->sent != 0)
+    {
+        ida_dispatch_hedge_cancel(req);
+    }
+
     if ((req->sent != 0) && (req->txn == IDA_SKIP_DFC))
     {
         ida_dispatch_incremental(ida, req);
@@ -356,18 +976,40 @@ void ida_dispatch_minimum(ida_private_t * ida, ida_request_t * req)
     }
 
     mask = ida->xl_up & ~req->failed & ~req->bad;
-    count = ida_get_childs(ida, req->required, &mask);
+
+    // Preferred subvolumes are always used when alive. Only the remaining
+    // answers are balanced between the other subvolumes.
+    preferred = mask & req->preferred;
+    count = sys_bits_count64(preferred);
+    if (count < req->required)
+    {
+        mask &= ~preferred;
+        count += ida_get_childs(ida, req->required - count, &mask);
+        mask |= preferred;
+    }
+    else
+    {
+        mask = preferred;
+        count = ida_get_childs(ida, req->required, &mask);
+    }
     if (count >= req->minimum)
     {
         if (req->txn == IDA_USE_DFC)
         {
             SYS_CALL(
-                dfc_begin, (ida->dfc, mask, NULL, *req->xdata, &req->txn),
+                dfc_begin, (ida->dfc, ida_dispatch_hedge_prepare(ida, req,
+                                                                 mask),
+                            NULL, *req->xdata, &req->txn),
                 E(),
                 GOTO(failed)
             );
         }
+        else
+        {
+            ida_dispatch_hedge_prepare(ida, req, mask);
+        }
         atomic_add(&req->pending, count, memory_order_seq_cst);
+        ida_dispatch_hedge_start(ida, req, mask);
         req->last_sent = mask;
         req->sent |= mask;
         i = 0;
@@ -380,10 +1022,7 @@ void ida_dispatch_minimum(ida_private_t * ida, ida_request_t * req)
                 E(),
                 CONTINUE()
             );
-            sys_gf_wind(req->rframe, NULL, ida->xl_list[idx],
-                        SYS_CBK(ida_dispatch_cbk, (ida, req, idx)),
-                        NULL, (uintptr_t *)req,
-                        (uintptr_t *)req + IDA_REQ_SIZE);
+            ida_child_wind(ida, req, idx, NULL, 0, 0, NULL);
             i++;
         } while ((i < count) && (mask != 0));
         if (i < count)
@@ -402,35 +1041,163 @@ failed:
     ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
 }
 
-SYS_CBK_CREATE(ida_dispatch_write_cbk, io, ((ida_private_t *, ida),
-                                            (ida_request_t *, req),
-                                            (uint32_t, id)))
+// State of a write while its fragments are being computed. Each slice of the
+// data is encoded as an independent chunk of a worker job.
+typedef struct
 {
-    SYS_GF_WIND_CBK_TYPE(writev) * args;
+    ida_worker_job_t job;
+    ida_private_t *  ida;
+    ida_request_t *  req;
+    uint8_t *        buffer;
+    off_t            offset;
+    size_t           size;
+    size_t           maxsize;
+    int32_t          count;
+    int32_t          slices;
+    int32_t          sources;
+    struct iovec *   source;
+    struct iovec *   vectors;
+    struct iobref ** iobrefs;
+    uint32_t *       rows;
+} ida_write_t;
+
+ida_worker_t * ida_get_workers(ida_private_t * ida, size_t size)
+{
+    if (size < ida->coding_min_size)
+    {
+        return NULL;
+    }
 
-    args = (SYS_GF_WIND_CBK_TYPE(writev) *)io;
-    if ((args->op_ret >= 0) || (args->op_errno != EUCLEAN))
+    return &ida->workers;
+}
+
+// The data is taken directly from the iovecs of the request. Only blocks that
+// are split between two iovecs, or that are not aligned, are copied to a
+// temporary buffer before encoding them.
+static void ida_dispatch_write_encode(ida_worker_job_t * job, uint32_t index)
+{
+    ida_write_t * write;
+    ida_iov_cursor_t cursor;
+    uint8_t * out[IDA_RABIN_MAX_ROWS];
+    uint8_t * ptr;
+    size_t slice, size, block;
+    uint64_t start;
+    int32_t i;
+
+    write = (ida_write_t *)job;
+    block = write->ida->block_size;
+    start = ida_time_now();
+
+    slice = write->size - index * write->maxsize;
+    if (slice > write->maxsize)
     {
-        SYS_LOCK(&req->lock, __ida_dispatch_cbk, (io, ida, req, id));
+        slice = write->maxsize;
     }
-    else
+    ida_stats_add(&write->ida->stats, IDA_STATS_ENCODED, slice);
+    for (i = 0; i < write->count; i++)
     {
-        req->handlers->dispatch(ida, req);
+        out[i] = write->vectors[i * write->slices + index].iov_base;
+    }
+    ida_iov_cursor_init(&cursor, write->source, write->sources,
+                        index * write->maxsize);
 
-        ida_complete(req);
+    {
+        uint8_t bounce[block] __attribute__((aligned(16)));
+
+        while (slice > 0)
+        {
+            size = ida_iov_cursor_contiguous(&cursor, &ptr);
+            if (size > slice)
+            {
+                size = slice;
+            }
+            size -= size % block;
+            if (size > 0)
+            {
+                ida_iov_cursor_advance(&cursor, NULL, size);
+            }
+            else
+            {
+                size = block;
+                ida_iov_cursor_advance(&cursor, bounce, size);
+                ptr = bounce;
+            }
+
+            // All fragments of each block are computed at once, so the user
+            // data is only read once from memory.
+            ida_rabin_split_multi(&write->ida->rabin, size, write->count,
+                                  write->rows, ptr, out);
+
+            for (i = 0; i < write->count; i++)
+            {
+                out[i] += size / write->ida->fragments;
+            }
+            slice -= size;
+        }
     }
+
+    ida_stats_add(&write->ida->stats, IDA_STATS_ENCODE_TIME,
+                  ida_time_now() - start);
 }
 
+static void ida_dispatch_write_wind(ida_worker_job_t * job)
+{
+    ida_write_t * write;
+    ida_private_t * ida;
+    ida_request_t * req;
+    int32_t idx, i, j;
+
+    write = (ida_write_t *)job;
+    ida = write->ida;
+    req = write->req;
+
+    if (write->buffer != NULL)
+    {
+        SYS_FREE_ALIGNED(write->buffer);
+    }
+
+    j = 0;
+    for (i = 0; i < write->count; i++)
+    {
+        idx = write->rows[i];
+        SYS_CALL(
+            dfc_attach, (req->txn, idx, req->xdata),
+            E(),
+            GOTO(next)
+        );
+        ida_child_wind(ida, req, idx, write->vectors + i * write->slices,
+                       write->slices, write->offset / ida->fragments,
+                       write->iobrefs[i]);
+        j++;
+    next:
+        iobref_unref(write->iobrefs[i]);
+    }
+
+    if (j < write->count)
+    {
+        dfc_failed(req->txn, write->count - j);
+    }
+
+    ida_pool_free(write);
+}
+
+// 'buffer' contains the partial blocks at the beginning and at the end of the
+// write, already filled with the current contents of the file. The user data
+// for these blocks is copied into them, but the rest of the data is encoded
+// directly from the iovecs of the request.
 void __ida_dispatch_write(ida_private_t * ida, ida_request_t * req,
                           uint8_t * buffer, off_t offset, size_t size,
                           size_t head, size_t tail, uintptr_t mask)
 {
     SYS_GF_FOP_CALL_TYPE(writev) * args;
-    struct iobref * iobref;
+    ida_iov_cursor_t cursor;
     struct iobuf * iobuf;
-    uint8_t * ptr;
+    ida_write_t * write;
     ssize_t remaining, slice, pagesize, maxsize;
-    int32_t idx, i, j, count;
+    size_t user_size, start, end, pos, low, high, length;
+    uintptr_t sent;
+    int32_t i, j, count, slices, sources;
+    bool first, last;
 
     if (atomic_dec(&req->data, memory_order_seq_cst) != 1)
     {
@@ -438,7 +1205,7 @@ void __ida_dispatch_write(ida_private_t * ida, ida_request_t * req,
     }
 
     count = sys_bits_count64(mask);
-    i = 0;
+    sent = mask;
 
     SYS_TEST(
         req->flags == 0,
@@ -449,38 +1216,119 @@ void __ida_dispatch_write(ida_private_t * ida, ida_request_t * req,
 
     args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req + IDA_REQ_SIZE);
 
-    ptr = buffer + head;
-    for (i = 0; i < args->vector.count; i++)
+    // 'start' and 'end' delimit the user data that doesn't fall into any of
+    // the staged blocks.
+    user_size = size - head - tail;
+    first = (head > 0) || ((tail > 0) && (size == ida->block_size));
+    last = (tail > 0) && (size > ida->block_size);
+    start = 0;
+    end = user_size;
+    if (first)
+    {
+        start = SYS_MIN(ida->block_size - head, user_size);
+        ida_iov_cursor_init(&cursor, args->vector.iovec, args->vector.count,
+                            0);
+        ida_iov_cursor_advance(&cursor, buffer + head, start);
+        ida_cache_store(&ida->cache, &req->cached[0], buffer);
+    }
+    if (last)
     {
-        memcpy(ptr, args->vector.iovec[i].iov_base,
-               args->vector.iovec[i].iov_len);
-        ptr += args->vector.iovec[i].iov_len;
+        end = user_size - (ida->block_size - tail);
+        ida_iov_cursor_init(&cursor, args->vector.iovec, args->vector.count,
+                            end);
+        ida_iov_cursor_advance(&cursor, buffer + ida->block_size,
+                               user_size - end);
+        ida_cache_store(&ida->cache, &req->cached[1],
+                        buffer + ida->block_size);
     }
 
     req->size = head + tail;
 
-    atomic_add(&req->pending, count, memory_order_seq_cst);
-    req->last_sent = req->sent = mask;
     pagesize = iobpool_default_pagesize(
                                 (struct iobuf_pool *)ida->xl->ctx->iobuf_pool);
     maxsize = pagesize * ida->fragments;
-    i = 0;
-    do
+    slices = (size + maxsize - 1) / maxsize;
+
+    SYS_PTR(
+        &write, ida_pool_alloc,
+        (sizeof(ida_write_t) +
+         (args->vector.count + 2) * sizeof(struct iovec) +
+         count * slices * sizeof(struct iovec) +
+         count * sizeof(struct iobref *) + count * sizeof(uint32_t)),
+        ENOMEM,
+        E(),
+        GOTO(failed)
+    );
+    write->ida = ida;
+    write->req = req;
+    write->buffer = buffer;
+    write->offset = offset;
+    write->size = size;
+    write->maxsize = maxsize;
+    write->count = count;
+    write->slices = slices;
+    write->source = (struct iovec *)(write + 1);
+    write->vectors = write->source + args->vector.count + 2;
+    write->iobrefs = (struct iobref **)(write->vectors + count * slices);
+    write->rows = (uint32_t *)(write->iobrefs + count);
+
+    // The data to encode is the staged head block, the user iovecs not
+    // covered by any staged block, and the staged tail block.
+    sources = 0;
+    if (first)
     {
-        struct iovec vector[args->vector.count];
+        write->source[sources].iov_base = buffer;
+        write->source[sources].iov_len = ida->block_size;
+        sources++;
+    }
+    pos = 0;
+    for (i = 0; i < args->vector.count; i++)
+    {
+        length = args->vector.iovec[i].iov_len;
+        low = SYS_MAX(pos, start);
+        high = SYS_MIN(pos + length, end);
+        if (low < high)
+        {
+            write->source[sources].iov_base =
+                            (uint8_t *)args->vector.iovec[i].iov_base +
+                            low - pos;
+            write->source[sources].iov_len = high - low;
+            sources++;
+        }
+        pos += length;
+    }
+    if (last)
+    {
+        write->source[sources].iov_base = buffer + ida->block_size;
+        write->source[sources].iov_len = ida->block_size;
+        sources++;
+    }
+    write->sources = sources;
 
-        idx = sys_bits_first_one_index64(mask);
+    memset(write->iobrefs, 0, count * sizeof(struct iobref *));
+    for (i = 0; i < count; i++)
+    {
+        write->rows[i] = sys_bits_first_one_index64(mask);
+        mask ^= 1ULL << write->rows[i];
 
         SYS_PTR(
-            &iobref, iobref_new, (),
+            &write->iobrefs[i], iobref_new, (),
             ENOMEM,
             E(),
-            GOTO(failed)
+            GOTO(failed_iobref)
         );
-        remaining = size;
-        j = 0;
-        ptr = buffer;
-        do
+    }
+
+    remaining = size;
+    for (j = 0; j < slices; j++)
+    {
+        slice = remaining;
+        if (slice > maxsize)
+        {
+            slice = maxsize;
+        }
+
+        for (i = 0; i < count; i++)
         {
             SYS_PTR(
                 &iobuf, iobuf_get, (ida->xl->ctx->iobuf_pool),
@@ -489,63 +1337,53 @@ void __ida_dispatch_write(ida_private_t * ida, ida_request_t * req,
                 GOTO(failed_iobref)
             );
             SYS_CODE(
-                iobref_add, (iobref, iobuf),
+                iobref_add, (write->iobrefs[i], iobuf),
                 ENOMEM,
                 E(),
                 GOTO(failed_iobuf)
             );
 
-            slice = remaining;
-            if (slice > maxsize)
-            {
-                slice = maxsize;
-            }
-            ida_rabin_split(slice, ida->fragments, idx, ptr, iobuf->ptr);
-            ptr += slice;
-
-            vector[j].iov_base = iobuf->ptr;
-            vector[j].iov_len = slice / ida->fragments;
-            j++;
+            write->vectors[i * slices + j].iov_base = iobuf->ptr;
+            write->vectors[i * slices + j].iov_len = slice / ida->fragments;
 
             iobuf_unref(iobuf);
+        }
 
-            remaining -= slice;
-        } while (remaining > 0);
-
-        SYS_CALL(
-            dfc_attach, (req->txn, idx, req->xdata),
-            E(),
-            GOTO(failed_iobuf)
-        );
-        SYS_IO(sys_gf_writev_wind, (req->rframe, NULL, ida->xl_list[idx],
-                                    args->fd, vector, j,
-                                    offset / ida->fragments, args->flags,
-                                    iobref, *req->xdata),
-               SYS_CBK(ida_dispatch_write_cbk, (ida, req, idx)));
-        iobref_unref(iobref);
-
-        mask ^= 1ULL << idx;
-    } while (++i < count);
-
-    if (i < count)
-    {
-        dfc_failed(req->txn, count - i);
+        remaining -= slice;
     }
 
-    SYS_FREE_ALIGNED(buffer);
+    atomic_add(&req->pending, count, memory_order_seq_cst);
+    req->last_sent = req->sent = sent;
+
+    // Big writes are encoded by the coding threads. The fragments are sent
+    // from the thread that completes the encoding.
+    ida_worker_run(ida_get_workers(ida, size), &write->job, slices,
+                   ida_dispatch_write_encode, ida_dispatch_write_wind);
 
     return;
 
 failed_iobuf:
     iobuf_unref(iobuf);
 failed_iobref:
-    iobref_unref(iobref);
+    for (i = 0; i < count; i++)
+    {
+        if (write->iobrefs[i] != NULL)
+        {
+            iobref_unref(write->iobrefs[i]);
+        }
+    }
+    ida_pool_free(write);
 failed:
-    dfc_failed(req->txn, count - i);
+    ida_cache_release(&ida->cache, &req->cached[0], false);
+    ida_cache_release(&ida->cache, &req->cached[1], false);
+    dfc_failed(req->txn, count);
     logE("WRITE failed in __ida_dispatch_write");
     ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
 
-    SYS_FREE_ALIGNED(buffer);
+    if (buffer != NULL)
+    {
+        SYS_FREE_ALIGNED(buffer);
+    }
 }
 
 SYS_CBK_CREATE(ida_dispatch_write_readv_cbk, io, ((ida_private_t *, ida),
@@ -578,6 +1416,56 @@ SYS_CBK_CREATE(ida_dispatch_write_readv_cbk, io, ((ida_private_t *, ida),
     __ida_dispatch_write(ida, req, buffer, offset, size, head, tail, mask);
 }
 
+// Starts the transaction of a write and looks for its partial blocks in the
+// stripe cache. Blocks must be claimed in the same order in which writes are
+// sent to the bricks, so the cache is kept locked meanwhile. 'found' tells
+// which of the partial blocks have been copied to 'buffer'.
+static err_t ida_dispatch_write_begin(ida_private_t * ida, ida_request_t * req,
+                                      fd_t * fd, uintptr_t mask,
+                                      uint8_t * buffer, off_t offset,
+                                      size_t size, bool first, bool last,
+                                      bool * found)
+{
+    size_t block;
+    err_t error;
+
+    found[0] = found[1] = false;
+
+    // Heal writes do not modify the contents of the file, so they don't need
+    // to use the cache.
+    if ((ida->cache.size == 0) || (req->minimum < ida->fragments))
+    {
+        return dfc_begin(ida->dfc, mask, fd->inode, *req->xdata, &req->txn);
+    }
+
+    block = ida->block_size;
+
+    ida_cache_lock(&ida->cache);
+
+    error = dfc_begin(ida->dfc, mask, fd->inode, *req->xdata, &req->txn);
+    if (error == 0)
+    {
+        if (first)
+        {
+            found[0] = __ida_cache_claim(&ida->cache, fd->inode->gfid, offset,
+                                         buffer, &req->cached[0]);
+        }
+        if (last)
+        {
+            found[1] = __ida_cache_claim(&ida->cache, fd->inode->gfid,
+                                         offset + size - block,
+                                         buffer + block, &req->cached[1]);
+        }
+        __ida_cache_invalidate(&ida->cache, fd->inode->gfid,
+                               offset + (first ? block : 0),
+                               size - (first + last) * block);
+    }
+
+    ida_cache_unlock(&ida->cache);
+
+    return error;
+}
+
 void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
 {
     SYS_GF_FOP_CALL_TYPE(writev) * args;
@@ -587,6 +1475,7 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
     size_t user_size, size, head, tail, tmp;
     uintptr_t mask;
     int32_t count;
+    bool first, last, found[2];
 
     SYS_TEST(
         req->sent == 0,
@@ -595,20 +1484,25 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
         GOTO(failed)
     );
 
+    args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req + IDA_REQ_SIZE);
+
+    user_offs = args->offset;
+    user_size = iov_length(args->vector.iovec, args->vector.count);
+
+    if (ida_dirty_mark(ida, req, user_offs, user_size, ida_dispatch_write))
+    {
+        return;
+    }
+
     mask = ida->xl_up & ~req->bad;
     count = sys_bits_count64(mask);
     SYS_TEST(
         count >= req->minimum,
         ENODATA,
         E(),
-        GOTO(failed)
+        GOTO(failed_dirty)
     );
 
-    args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req + IDA_REQ_SIZE);
-
-    user_offs = args->offset;
-    user_size = iov_length(args->vector.iovec, args->vector.count);
-
     head = user_offs % ida->block_size;
     offs = user_offs - head;
     size = user_size + head;
@@ -616,26 +1510,39 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
     tail = tmp - (size + tmp) % ida->block_size;
     size += tail;
 
-    req->data = 1;
-    if (req->minimum >= ida->fragments)
-    {
-        req->data += (head > 0) + ((tail > 0) && (size > ida->block_size));
-    }
+    // Only partially written blocks need to be staged. If the write fits
+    // into a single block, it's handled as the first one.
+    first = (head > 0) || ((tail > 0) && (size == ida->block_size));
+    last = (tail > 0) && (size > ida->block_size);
 
     req->flags = 0;
-    SYS_ALLOC_ALIGNED(
-        &buffer, size, 16, sys_mt_uint8_t,
-        E(),
-        GOTO(failed)
-    );
+    buffer = NULL;
+    if (first || last)
+    {
+        SYS_ALLOC_ALIGNED(
+            &buffer, 2 * ida->block_size, 16, sys_mt_uint8_t,
+            E(),
+            GOTO(failed_dirty)
+        );
+    }
 
     SYS_CALL(
-        dfc_begin, (ida->dfc, mask, args->fd->inode, *req->xdata, &req->txn),
+        ida_dispatch_write_begin, (ida, req, args->fd, mask, buffer, offs,
+                                   size, first, last, found),
         E(),
         GOTO(failed_buffer)
     );
+    // Only the partial blocks not found in the cache need to be read.
+    first = first && !found[0];
+    last = last && !found[1];
+
+    req->data = 1;
+    if (req->minimum >= ida->fragments)
+    {
+        req->data += first + last;
+    }
 
-    if (head > 0)
+    if (first)
     {
         if (req->minimum >= ida->fragments)
         {
@@ -645,6 +1552,7 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
                 E(),
                 GOTO(failed_dfc)
             );
+            ida_stats_add(&ida->stats, IDA_STATS_RMW_READS, 1);
             SYS_IO(sys_gf_readv_wind, (req->rframe, NULL, ida->xl, args->fd,
                                        ida->block_size, offs, 0, xdata),
                    SYS_CBK(ida_dispatch_write_readv_cbk, (ida, req, buffer,
@@ -659,7 +1567,7 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
         }
     }
 
-    if ((tail > 0) && (size > ida->block_size))
+    if (last)
     {
         if (req->minimum >= ida->fragments)
         {
@@ -669,12 +1577,13 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
                 E(),
                 GOTO(failed_dfc)
             );
+            ida_stats_add(&ida->stats, IDA_STATS_RMW_READS, 1);
             SYS_IO(sys_gf_readv_wind, (req->rframe, NULL, ida->xl, args->fd,
                                        ida->block_size,
                                        offs + size - ida->block_size, 0,
                                        xdata),
                    SYS_CBK(ida_dispatch_write_readv_cbk, (ida, req, buffer,
-                                                          buffer + size -
+                                                          buffer +
                                                           ida->block_size,
                                                           offs, size, head,
                                                           tail, mask)
@@ -683,7 +1592,7 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
         }
         else
         {
-            memset(buffer + size - ida->block_size, 0, ida->block_size);
+            memset(buffer + ida->block_size, 0, ida->block_size);
         }
     }
 
@@ -693,9 +1602,85 @@ void ida_dispatch_write(ida_private_t * ida, ida_request_t * req)
 
 failed_dfc:
     dfc_failed(req->txn, count);
+    ida_cache_release(&ida->cache, &req->cached[0], false);
+    ida_cache_release(&ida->cache, &req->cached[1], false);
 failed_buffer:
-    SYS_FREE(buffer);
+    if (buffer != NULL)
+    {
+        SYS_FREE_ALIGNED(buffer);
+    }
+failed_dirty:
+    ida_dirty_cancel(req);
 failed:
     logE("WRITE failed in ida_dispatch_write");
     ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
 }
+
+// Sends to each subvolume its own fragment, already computed by the caller.
+// The vector of the request is divided in as many parts of the same number
+// of iovecs as subvolumes are not marked as bad, ordered by index.
+void ida_dispatch_fragments(ida_private_t * ida, ida_request_t * req)
+{
+    SYS_GF_FOP_CALL_TYPE(writev) * args;
+    uintptr_t targets, mask;
+    int32_t idx, i, count, slices;
+
+    SYS_TEST(
+        req->sent == 0,
+        EIO,
+        D(),
+        GOTO(failed)
+    );
+
+    args = (SYS_GF_FOP_CALL_TYPE(writev) *)((uintptr_t *)req + IDA_REQ_SIZE);
+
+    targets = ida->node_mask & ~req->bad;
+    slices = args->vector.count / sys_bits_count64(targets);
+    mask = targets & ida->xl_up;
+    count = sys_bits_count64(mask);
+    SYS_TEST(
+        count >= req->minimum,
+        ENODATA,
+        E(),
+        GOTO(failed)
+    );
+
+    if (req->txn == IDA_USE_DFC)
+    {
+        SYS_CALL(
+            dfc_begin, (ida->dfc, mask, args->fd->inode, *req->xdata,
+                        &req->txn),
+            E(),
+            GOTO(failed)
+        );
+    }
+    atomic_add(&req->pending, count, memory_order_seq_cst);
+    req->last_sent = req->sent = mask;
+    for (i = 0; targets != 0; i++)
+    {
+        idx = sys_bits_first_one_index64(targets);
+        targets ^= 1ULL << idx;
+        if ((mask & (1ULL << idx)) == 0)
+        {
+            continue;
+        }
+        SYS_CALL(
+            dfc_attach, (req->txn, idx, req->xdata),
+            E(),
+            CONTINUE()
+        );
+        count--;
+        ida_child_wind(ida, req, idx, args->vector.iovec + i * slices, slices,
+                       args->offset, args->iobref);
+    }
+    if (count > 0)
+    {
+        dfc_failed(req->txn, count);
+    }
+
+    return;
+
+failed:
+    logE("WRITE failed in ida_dispatch_fragments");
+    ida_unwind(req, EIO, (uintptr_t *)req + IDA_REQ_SIZE);
+}
@@ -27,6 +27,12 @@
 #include "xlator.h"
 
 #include "ida-types.h"
+#include "ida-rabin.h"
+#include "ida-worker.h"
+#include "ida-cache.h"
+#include "ida-stats.h"
+#include "ida-trace.h"
+#include "ida-crawl.h"
 
 #define IDA_EXECUTE_MAX INT_MIN
 
@@ -35,23 +41,77 @@
 
 #define IDA_IS_TXN(_txn) ((uintptr_t)(_txn) > 1)
 
+// State of the additional subvolume reserved by a request to send it a copy
+// if the answers of the other subvolumes are late.
+#define IDA_HEDGE_NONE  0
+#define IDA_HEDGE_ARMED 1
+#define IDA_HEDGE_DONE  2
+
+#define IDA_HEDGE_FIRED ((uintptr_t)1)
+
+// Average answer time of a subvolume, in microseconds scaled by
+// 2^IDA_LATENCY_SHIFT, its mean deviation scaled by 2^IDA_DEVIATION_SHIFT,
+// and the number of requests sent to it that have not been answered yet.
+// When the number of pending requests is limited, the requests that exceed
+// the limit wait in 'queue'.
+#define IDA_LATENCY_SHIFT 3
+#define IDA_DEVIATION_SHIFT 2
+
+// Added to the cost of a subvolume that has reached the maximum number of
+// pending requests.
+#define IDA_CHILD_SATURATED (1ULL << 48)
+
 typedef struct
 {
-    xlator_t *  xl;
-    uint32_t    nodes;
-    uint32_t    fragments;
-    uint32_t    redundancy;
-    uint32_t    block_size;
-    uint64_t    device;
-    uintptr_t   node_mask;
-    uintptr_t   xl_up;
-    uintptr_t   locked_mask;
-    sys_mutex_t lock;
-    xlator_t ** xl_list;
-    dfc_t *     dfc;
-    uintptr_t * delay;
-    int32_t     index;
-    bool        up;
+    uint64_t         latency;
+    uint64_t         deviation;
+    int32_t          inflight;
+    int32_t          queued;
+    uint64_t         parked;
+    gf_lock_t        lock;
+    struct list_head queue;
+} ida_child_t;
+
+typedef struct
+{
+    xlator_t *   xl;
+    uint32_t     nodes;
+    uint32_t     fragments;
+    uint32_t     redundancy;
+    uint32_t     block_size;
+    uint64_t     device;
+    uintptr_t    node_mask;
+    uintptr_t    xl_up;
+    uintptr_t    locked_mask;
+    sys_mutex_t  lock;
+    xlator_t **  xl_list;
+    dfc_t *      dfc;
+    uintptr_t *  delay;
+    int32_t      index;
+    bool         up;
+    bool         systematic;
+    ida_rabin_t  rabin;
+    bool         pooled;
+    ida_worker_t workers;
+    int32_t      coding_threads;
+    uint64_t     coding_min_size;
+    uint64_t     stripe_cache_size;
+    ida_cache_t  cache;
+    uint64_t     coalesce_size;
+    int32_t      coalesce_timeout;
+    bool         hedging;
+    int32_t      queue_depth;
+    ida_child_t  childs[IDA_RABIN_MAX_ROWS];
+    ida_stats_t  stats;
+    int32_t      trace_size;
+    ida_trace_t  trace;
+    int32_t      healing;
+    uint64_t     heal_chunk_size;
+    int32_t      heal_window;
+    uint64_t     dirty_size;
+    int32_t      crawl_interval;
+    int32_t      crawl_heals;
+    ida_crawl_t  crawl;
 } ida_private_t;
 
 struct _ida_args_cbk
@@ -108,9 +168,19 @@ typedef struct _ida_request ida_request_t;
 struct _ida_answer;
 typedef struct _ida_answer ida_answer_t;
 
+struct _ida_fragment;
+typedef struct _ida_fragment ida_fragment_t;
+
 struct _ida_handlers;
 typedef struct _ida_handlers ida_handlers_t;
 
+typedef void (* ida_rebuilt_f)(ida_request_t *, ida_answer_t *, int32_t);
+
+// A rebuild handler can return this value to indicate that the answer is
+// still being rebuilt in background. It must call ida_rebuild_done() once
+// finished.
+#define IDA_REBUILD_ASYNC 1
+
 struct _ida_handlers
 {
     bool           (* prepare)(ida_private_t *, ida_request_t *);
@@ -122,6 +192,7 @@ struct _ida_handlers
     int32_t        (* rebuild)(ida_private_t *, ida_request_t *,
                                ida_answer_t *);
     ida_answer_t * (* copy)(uintptr_t *);
+    uint64_t       (* fingerprint)(uintptr_t *);
 };
 
 struct _ida_request
@@ -144,20 +215,48 @@ struct _ida_request
     uintptr_t           last_sent;
     uintptr_t           failed;
     uintptr_t           bad;
+    uintptr_t           preferred;
     dict_t **           xdata;
     sys_lock_t          lock;
     struct list_head    answers;
+    ida_rebuilt_f       rebuilt;
     int32_t             completed;
+    ida_cache_claim_t   cached[2];
+    ida_cache_barrier_t * barrier;
+    int32_t             hedge;
+    int32_t             hedge_idx;
+    uintptr_t           hedge_delay;
+    int32_t             fop;
+    uint64_t            started;
+    bool                dirty;
+    uint64_t            dirty_slots;
 //    int32_t             dfc;
 };
 
+// Answers with different fingerprints can never be combined, so they are
+// compared before calling the combine handler. Answers that need the data of
+// each subvolume to be rebuilt keep it in 'fragments', except for the first
+// subvolume, whose data is in the answer itself.
 struct _ida_answer
 {
     struct list_head list;
     uint32_t         count;
     int32_t          id;
     uintptr_t        mask;
-    ida_answer_t *   next;
+    uint64_t         fingerprint;
+    int32_t          refs;
+    ida_fragment_t * fragments;
+};
+
+// References to the buffers of the answer of a single subvolume.
+struct _ida_fragment
+{
+    ida_fragment_t * next;
+    int32_t          id;
+    int32_t          count;
+    struct iobref *  iobref;
+    data_t *         data;
+    struct iovec     vector[];
 };
 
 #define IDA_REQ_SIZE SYS_CALLS_ADJUST_SIZE(sizeof(ida_request_t))
@@ -181,6 +280,7 @@ struct _ida_answer
     void ida_completed_##_fop(call_frame_t * frame, err_t error, \
                               ida_request_t * req, uintptr_t * data); \
     ida_answer_t * ida_copy_##_fop(uintptr_t * io); \
+    uint64_t ida_fingerprint_##_fop(uintptr_t * io); \
     extern ida_handlers_t ida_handlers_##_fop
 
 IDA_FOP_DECLARE(access);
@@ -225,9 +325,20 @@ IDA_FOP_DECLARE(writev);
 IDA_FOP_DECLARE(xattrop);
 IDA_FOP_DECLARE(fxattrop);
 
+ida_worker_t * ida_get_workers(ida_private_t * ida, size_t size);
+uint64_t ida_answer_fingerprint(int32_t op_ret, int32_t op_errno,
+                                dict_t * xdata, struct iatt * iatt);
+uintptr_t ida_get_bad(xlator_t * xl, loc_t * loc1, loc_t * loc2, fd_t * fd);
+void ida_rebuild_done(ida_request_t * req, ida_answer_t * ans, int32_t result);
+bool ida_fragment_add(ida_answer_t * ans, int32_t id, struct iovec * vector,
+                      int32_t count, struct iobref * iobref, data_t * data);
+
 void ida_dispatch_incremental(ida_private_t * ida, ida_request_t * req);
 void ida_dispatch_all(ida_private_t * ida, ida_request_t * req);
 void ida_dispatch_minimum(ida_private_t * ida, ida_request_t * req);
 void ida_dispatch_write(ida_private_t * ida, ida_request_t * req);
+void ida_dispatch_fragments(ida_private_t * ida, ida_request_t * req);
+void ida_dispatch_truncate(ida_private_t * ida, ida_request_t * req);
+void ida_dispatch_open(ida_private_t * ida, ida_request_t * req);
 
 #endif /* __IDA_MANAGER_H__ */
@@ -34,6 +34,11 @@ enum gf_ida_mem_types_
     ida_mt_xlator_t,
     ida_mt_ida_fd_ctx_t,
     ida_mt_uint8_t,
+    ida_mt_pthread_t,
+    ida_mt_ida_cache_t,
+    ida_mt_ida_stats_t,
+    ida_mt_ida_trace_t,
+    ida_mt_ida_dirty_inode_t,
     ida_mt_end
 };
 
@@ -0,0 +1,241 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "ida-pool.h"
+
+typedef struct _ida_pool_block ida_pool_block_t;
+
+struct _ida_pool_block
+{
+    ida_pool_block_t * next;
+    int32_t            class;
+} __attribute__((aligned(16)));
+
+typedef struct
+{
+    struct list_head   list;
+    ida_pool_block_t * blocks[IDA_POOL_CLASSES];
+    int32_t            count[IDA_POOL_CLASSES];
+    bool               registered;
+} ida_pool_cache_t;
+
+// Each thread keeps the blocks it releases, so most requests can be handled
+// without calling the memory allocator. Blocks are usually allocated by one
+// thread and released by another one, but the number of blocks of each thread
+// is bounded, so they are simply returned to the allocator when the cache is
+// full.
+//
+// Blocks are shared by all instances of the translator and can be released
+// after the instance that allocated them is gone, so they are not accounted
+// to any of them. The caches of all threads are released when the last
+// instance is destroyed, so nothing remains once the library is unloaded.
+static __thread ida_pool_cache_t ida_pool_cache;
+
+static pthread_mutex_t ida_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct list_head ida_pool_caches = { &ida_pool_caches,
+                                            &ida_pool_caches };
+static pthread_key_t ida_pool_key;
+static int32_t ida_pool_users = 0;
+
+// Must be called with ida_pool_lock held.
+static void __ida_pool_drain(ida_pool_cache_t * cache)
+{
+    ida_pool_block_t * block;
+    int32_t i;
+
+    list_del_init(&cache->list);
+    cache->registered = false;
+
+    for (i = 0; i < IDA_POOL_CLASSES; i++)
+    {
+        while (cache->blocks[i] != NULL)
+        {
+            block = cache->blocks[i];
+            cache->blocks[i] = block->next;
+            free(block);
+        }
+        cache->count[i] = 0;
+    }
+}
+
+static void ida_pool_thread_exit(void * data)
+{
+    ida_pool_cache_t * cache;
+
+    cache = data;
+
+    pthread_mutex_lock(&ida_pool_lock);
+
+    if (cache->registered)
+    {
+        __ida_pool_drain(cache);
+    }
+
+    pthread_mutex_unlock(&ida_pool_lock);
+}
+
+// The cache of the thread is registered the first time a block is kept in
+// it, so that it's released when the thread exits or when the last instance
+// is destroyed. Nothing is kept once that has happened.
+static bool ida_pool_register(ida_pool_cache_t * cache)
+{
+    if (!cache->registered)
+    {
+        pthread_mutex_lock(&ida_pool_lock);
+
+        if ((ida_pool_users > 0) &&
+            (pthread_setspecific(ida_pool_key, cache) == 0))
+        {
+            list_add_tail(&cache->list, &ida_pool_caches);
+            cache->registered = true;
+        }
+
+        pthread_mutex_unlock(&ida_pool_lock);
+    }
+
+    return cache->registered;
+}
+
+err_t ida_pool_initialize(void)
+{
+    err_t error;
+
+    error = 0;
+
+    pthread_mutex_lock(&ida_pool_lock);
+
+    if (ida_pool_users == 0)
+    {
+        error = pthread_key_create(&ida_pool_key, ida_pool_thread_exit);
+    }
+    if (error == 0)
+    {
+        ida_pool_users++;
+    }
+
+    pthread_mutex_unlock(&ida_pool_lock);
+
+    if (error != 0)
+    {
+        logE("Unable to register the release of cached memory blocks");
+    }
+
+    return error;
+}
+
+// No other thread can be using the pool when the last instance is
+// destroyed.
+void ida_pool_terminate(void)
+{
+    ida_pool_cache_t * cache, * tmp;
+
+    pthread_mutex_lock(&ida_pool_lock);
+
+    if (--ida_pool_users == 0)
+    {
+        list_for_each_entry_safe(cache, tmp, &ida_pool_caches, list)
+        {
+            __ida_pool_drain(cache);
+        }
+        pthread_key_delete(ida_pool_key);
+    }
+
+    pthread_mutex_unlock(&ida_pool_lock);
+}
+
+static int32_t ida_pool_class(size_t size)
+{
+    int32_t class;
+
+    size += sizeof(ida_pool_block_t);
+    for (class = 0; class < IDA_POOL_CLASSES; class++)
+    {
+        if (size <= 1ULL << (IDA_POOL_MIN_SHIFT +
+                             class * IDA_POOL_CLASS_SHIFT))
+        {
+            return class;
+        }
+    }
+
+    return -1;
+}
+
+void * ida_pool_alloc(size_t size)
+{
+    ida_pool_cache_t * cache;
+    ida_pool_block_t * block;
+    int32_t class;
+
+    class = ida_pool_class(size);
+    if (class >= 0)
+    {
+        cache = &ida_pool_cache;
+        block = cache->blocks[class];
+        if (block != NULL)
+        {
+            cache->blocks[class] = block->next;
+            cache->count[class]--;
+
+            return block + 1;
+        }
+
+        size = (1ULL << (IDA_POOL_MIN_SHIFT + class * IDA_POOL_CLASS_SHIFT)) -
+               sizeof(ida_pool_block_t);
+    }
+
+    block = malloc(sizeof(ida_pool_block_t) + size);
+    if (block == NULL)
+    {
+        logE("Unable to allocate a memory block of %zu bytes", size);
+
+        return NULL;
+    }
+    block->class = class;
+
+    return block + 1;
+}
+
+void ida_pool_free(void * ptr)
+{
+    ida_pool_cache_t * cache;
+    ida_pool_block_t * block;
+
+    block = (ida_pool_block_t *)ptr - 1;
+    if (block->class >= 0)
+    {
+        cache = &ida_pool_cache;
+        if ((cache->count[block->class] < IDA_POOL_DEPTH) &&
+            ida_pool_register(cache))
+        {
+            block->next = cache->blocks[block->class];
+            cache->blocks[block->class] = block;
+            cache->count[block->class]++;
+
+            return;
+        }
+    }
+
+    free(block);
+}
@@ -0,0 +1,41 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_POOL_H__
+#define __IDA_POOL_H__
+
+#include "xlator.h"
+
+// Blocks are grouped in classes of 128, 512, 2048 and 8192 bytes, including
+// a small header. Bigger blocks are not cached.
+#define IDA_POOL_CLASSES 4
+#define IDA_POOL_MIN_SHIFT 7
+#define IDA_POOL_CLASS_SHIFT 2
+
+// Maximum number of free blocks of each class kept by each thread.
+#define IDA_POOL_DEPTH 64
+
+err_t ida_pool_initialize(void);
+void ida_pool_terminate(void);
+
+void * ida_pool_alloc(size_t size);
+void ida_pool_free(void * ptr);
+
+#endif /* __IDA_POOL_H__ */
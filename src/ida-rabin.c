@@ -18,14 +18,214 @@
   <http://www.gnu.org/licenses/>.
 */
 
+#include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <cpuid.h>
 
 #include "ida-rabin.h"
+#include "ida-gf-avx2.h"
+#include "ida-gf-avx512.h"
+
+#define IDA_RABIN_GROUP (16 * IDA_RABIN_BITS)
+
+// Amount of input data processed for all rows before moving to the next
+// block. It must comfortably fit into the L1 cache.
+#define IDA_RABIN_BLOCK (16 * 1024)
+
+#define IDA_RABIN_CPUID_OSXSAVE (1 << 27)
+#define IDA_RABIN_CPUID_AVX     (1 << 28)
+#define IDA_RABIN_CPUID_AVX2    (1 << 5)
+#define IDA_RABIN_CPUID_AVX512F (1 << 16)
+
+#define IDA_RABIN_XCR0_AVX      0x06
+#define IDA_RABIN_XCR0_AVX512   0xE6
+
+// Number of entries of the decode matrix cache. It must be a power of 2.
+#define IDA_RABIN_CACHE_BITS 7
+#define IDA_RABIN_CACHE_SIZE (1 << IDA_RABIN_CACHE_BITS)
+
+// Entries of the decode matrix cache are shared by all users of the same
+// combination of fragments. Each one is released when it has been evicted
+// from the cache and no one else is using it. When 'targets' is not 0, the
+// rows compute the fragments in 'targets' instead of the original data.
+typedef struct
+{
+    uint64_t        mask;
+    uint64_t        targets;
+    uint32_t        columns;
+    bool            systematic;
+    uint32_t        refs;
+    ida_rabin_row_t rows[];
+} ida_rabin_matrix_t;
+
+typedef struct
+{
+    const char * name;
+    uint32_t     groups;
+    void      (* apply)(uint32_t count, uint32_t columns,
+                        ida_rabin_row_t * row, uint8_t ** in,
+                        uint32_t in_stride, uint8_t * out,
+                        uint32_t out_stride);
+} ida_rabin_backend_t;
 
 static uint32_t GfPow[IDA_RABIN_SIZE << 1];
 static uint32_t GfLog[IDA_RABIN_SIZE << 1];
 
+static const ida_rabin_backend_t * ida_rabin_backend;
+static const ida_rabin_backend_t * ida_rabin_backend_best;
+
+static pthread_rwlock_t ida_rabin_cache_lock = PTHREAD_RWLOCK_INITIALIZER;
+static ida_rabin_matrix_t * ida_rabin_cache[IDA_RABIN_CACHE_SIZE];
+
+static uint32_t ida_rabin_mul(uint32_t a, uint32_t b)
+{
+    if (a && b)
+    {
+        return GfPow[GfLog[a] + GfLog[b]];
+    }
+    return 0;
+}
+
+static uint32_t ida_rabin_div(uint32_t a, uint32_t b)
+{
+    if (b)
+    {
+        if (a)
+        {
+            return GfPow[IDA_RABIN_SIZE - 1 + GfLog[a] - GfLog[b]];
+        }
+        return 0;
+    }
+    return IDA_RABIN_SIZE;
+}
+
+// Each backend computes one row of the product for 'count' groups, where
+// 'count' is a multiple of the number of groups that the backend handles at
+// once. Consecutive groups of the same source (or of the output) are always
+// separated by a fixed stride, so the wide backends only need to know the
+// address of the first group.
+
+#define IDA_RABIN_SSE2_LOAD(_ptr, _stride) ida_gf_load(_ptr)
+#define IDA_RABIN_SSE2_XOR(_ptr, _stride) ida_gf_xor(_ptr)
+#define IDA_RABIN_SSE2_STORE(_ptr, _stride) ida_gf_store(_ptr)
+#define IDA_RABIN_SSE2_END() do { } while (0)
+
+#define IDA_RABIN_AVX2_LOAD(_ptr, _stride) \
+    ida_gf_avx2_load(_ptr, (_ptr) + (_stride))
+#define IDA_RABIN_AVX2_XOR(_ptr, _stride) \
+    ida_gf_avx2_xor(_ptr, (_ptr) + (_stride))
+#define IDA_RABIN_AVX2_STORE(_ptr, _stride) \
+    ida_gf_avx2_store(_ptr, (_ptr) + (_stride))
+#define IDA_RABIN_AVX2_END() ida_gf_avx2_end()
+
+#define IDA_RABIN_AVX512_LOAD(_ptr, _stride) \
+    ida_gf_avx512_load(_ptr, (_ptr) + (_stride), (_ptr) + 2 * (_stride), \
+                       (_ptr) + 3 * (_stride))
+#define IDA_RABIN_AVX512_XOR(_ptr, _stride) \
+    ida_gf_avx512_xor(_ptr, (_ptr) + (_stride), (_ptr) + 2 * (_stride), \
+                      (_ptr) + 3 * (_stride))
+#define IDA_RABIN_AVX512_STORE(_ptr, _stride) \
+    ida_gf_avx512_store(_ptr, (_ptr) + (_stride), (_ptr) + 2 * (_stride), \
+                        (_ptr) + 3 * (_stride))
+#define IDA_RABIN_AVX512_END() ida_gf_avx512_end()
+
+#define IDA_RABIN_BACKEND(_name, _NAME, _groups, _table) \
+    static void ida_rabin_apply_##_name(uint32_t count, uint32_t columns, \
+                                        ida_rabin_row_t * row, uint8_t ** in, \
+                                        uint32_t in_stride, uint8_t * out, \
+                                        uint32_t out_stride) \
+    { \
+        uint32_t i, f, off; \
+        off = 0; \
+        for (f = 0; f < count; f += _groups) \
+        { \
+            IDA_RABIN_##_NAME##_LOAD(in[row->first] + off, in_stride); \
+            for (i = 0; i < row->count; i++) \
+            { \
+                _table[row->factor[i]](); \
+                if (row->source[i] < columns) \
+                { \
+                    IDA_RABIN_##_NAME##_XOR(in[row->source[i]] + off, \
+                                            in_stride); \
+                } \
+            } \
+            IDA_RABIN_##_NAME##_STORE(out, out_stride); \
+            off += in_stride * _groups; \
+            out += out_stride * _groups; \
+        } \
+        IDA_RABIN_##_NAME##_END(); \
+    } \
+    static const ida_rabin_backend_t ida_rabin_backend_##_name = \
+    { \
+        .name   = #_name, \
+        .groups = _groups, \
+        .apply  = ida_rabin_apply_##_name \
+    }
+
+IDA_RABIN_BACKEND(sse2,   SSE2,   1,                    ida_gf_mul_table);
+IDA_RABIN_BACKEND(avx2,   AVX2,   IDA_GF_AVX2_GROUPS,   ida_gf_avx2_mul_table);
+IDA_RABIN_BACKEND(avx512, AVX512, IDA_GF_AVX512_GROUPS,
+                  ida_gf_avx512_mul_table);
+
+// Available backends, from the slowest to the fastest.
+static const ida_rabin_backend_t * ida_rabin_backends[] =
+{
+    &ida_rabin_backend_sse2,
+    &ida_rabin_backend_avx2,
+    &ida_rabin_backend_avx512,
+    NULL
+};
+
+static uint64_t ida_rabin_xgetbv(void)
+{
+    uint32_t eax, edx;
+
+    __asm__ __volatile__
+    (
+        "\txgetbv\n"
+        : "=a" (eax), "=d" (edx)
+        : "c" (0)
+    );
+
+    return ((uint64_t)edx << 32) | eax;
+}
+
+static const ida_rabin_backend_t * ida_rabin_detect(void)
+{
+    uint32_t eax, ebx, ecx, edx;
+    uint64_t xcr0;
+
+    // SSE2 is always available on x86_64. Wider backends need both CPU and
+    // OS support (the OS must save the extended registers on context
+    // switches).
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+        ((ecx & IDA_RABIN_CPUID_OSXSAVE) == 0) ||
+        ((ecx & IDA_RABIN_CPUID_AVX) == 0) ||
+        (__get_cpuid_max(0, NULL) < 7))
+    {
+        return &ida_rabin_backend_sse2;
+    }
+
+    xcr0 = ida_rabin_xgetbv();
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    if (((ebx & IDA_RABIN_CPUID_AVX512F) != 0) &&
+        ((xcr0 & IDA_RABIN_XCR0_AVX512) == IDA_RABIN_XCR0_AVX512))
+    {
+        return &ida_rabin_backend_avx512;
+    }
+    if (((ebx & IDA_RABIN_CPUID_AVX2) != 0) &&
+        ((xcr0 & IDA_RABIN_XCR0_AVX) == IDA_RABIN_XCR0_AVX))
+    {
+        return &ida_rabin_backend_avx2;
+    }
+
+    return &ida_rabin_backend_sse2;
+}
+
 void ida_rabin_initialize(void)
 {
     uint32_t i;
@@ -42,91 +242,112 @@ void ida_rabin_initialize(void)
         GfPow[i + IDA_RABIN_SIZE - 1] = GfPow[i];
         GfLog[GfPow[i] + IDA_RABIN_SIZE - 1] = GfLog[GfPow[i]] = i;
     }
+
+    ida_rabin_backend_best = ida_rabin_detect();
+    ida_rabin_backend = ida_rabin_backend_best;
 }
 
-static uint32_t ida_rabin_mul(uint32_t a, uint32_t b)
+const char * ida_rabin_backend_name(void)
 {
-    if (a && b)
-    {
-        return GfPow[GfLog[a] + GfLog[b]];
-    }
-    return 0;
+    return ida_rabin_backend->name;
 }
 
-static uint32_t ida_rabin_div(uint32_t a, uint32_t b)
+// Forces the use of a specific backend. Only backends not faster than the one
+// detected at initialization can be selected. This is only intended for
+// benchmarking and testing.
+int32_t ida_rabin_backend_select(const char * name)
 {
-    if (b)
+    uint32_t i;
+    bool supported;
+
+    supported = true;
+    for (i = 0; ida_rabin_backends[i] != NULL; i++)
     {
-        if (a)
+        if (strcmp(ida_rabin_backends[i]->name, name) == 0)
         {
-            return GfPow[IDA_RABIN_SIZE - 1 + GfLog[a] - GfLog[b]];
+            if (!supported)
+            {
+                return ENOTSUP;
+            }
+            ida_rabin_backend = ida_rabin_backends[i];
+
+            return 0;
+        }
+        if (ida_rabin_backends[i] == ida_rabin_backend_best)
+        {
+            supported = false;
         }
-        return 0;
     }
-    return IDA_RABIN_SIZE;
+
+    return ENOENT;
 }
 
-uint32_t ida_rabin_split(uint32_t size, uint32_t columns, uint32_t row, uint8_t * in, uint8_t * out)
+// Computes the sequence of operations needed to multiply a row of
+// coefficients by the sources.
+static void ida_rabin_row_build(ida_rabin_row_t * row, uint8_t * coef,
+                                uint32_t columns)
 {
-    uint32_t i, j;
+    uint8_t tmp[IDA_RABIN_MAX_COLUMNS + 1];
+    uint32_t j, k;
+
+    memcpy(tmp, coef, columns);
+    tmp[columns] = 1;
 
-    size /= 16 * IDA_RABIN_BITS * columns;
-    row++;
-    for (j = 0; j < size; j++)
+    j = 0;
+    while (tmp[j] == 0)
+    {
+        j++;
+    }
+    row->first = j;
+    row->count = 0;
+    while (j < columns)
     {
-        ida_gf_load(in);
-        in += 16 * IDA_RABIN_BITS;
-        for (i = 1; i < columns; i++)
+        k = j + 1;
+        while (tmp[k] == 0)
         {
-            ida_gf_mul_table[row]();
-            ida_gf_xor(in);
-            in += 16 * IDA_RABIN_BITS;
+            k++;
         }
-        ida_gf_store(out);
-        out += 16 * IDA_RABIN_BITS;
+        row->factor[row->count] = ida_rabin_div(tmp[j], tmp[k]);
+        row->source[row->count] = k;
+        row->count++;
+        j = k;
     }
-
-    return size * 16 * IDA_RABIN_BITS;
 }
 
-uint32_t ida_rabin_merge(uint32_t size, uint32_t columns, uint32_t * rows, uint8_t ** in, uint8_t * out)
+// Inverts the square matrix 'mtx' using Gauss-Jordan elimination. 'mtx' is
+// destroyed. The matrix must be invertible.
+static void ida_rabin_invert(uint32_t columns, uint8_t mtx[][columns],
+                             uint8_t inv[][columns])
 {
-    uint32_t i, j, k;
-    uint32_t f, off, mask;
-    uint8_t inv[16][17];
-    uint8_t mtx[16][16];
-    uint8_t * p[16];
+    uint32_t i, j, k, f;
 
-    size /= 16 * IDA_RABIN_BITS;
-
-    memset(inv, 0, sizeof(inv));
-    memset(mtx, 0, sizeof(mtx));
-    mask = 0;
+    memset(inv, 0, columns * columns);
     for (i = 0; i < columns; i++)
     {
         inv[i][i] = 1;
-        inv[i][columns] = 1;
     }
-    k = 0;
+
     for (i = 0; i < columns; i++)
     {
-        while ((mask & 1) != 0)
+        // Rows of a systematic matrix contain many zeros, so a row with a
+        // non null pivot may need to be brought in.
+        j = i;
+        while (mtx[j][i] == 0)
         {
-            k++;
-            mask >>= 1;
+            j++;
         }
-        mtx[k][columns - 1] = 1;
-        for (j = columns - 1; j > 0; j--)
+        if (j != i)
         {
-            mtx[k][j - 1] = ida_rabin_mul(mtx[k][j], rows[i] + 1);
+            for (k = 0; k < columns; k++)
+            {
+                f = mtx[i][k];
+                mtx[i][k] = mtx[j][k];
+                mtx[j][k] = f;
+                f = inv[i][k];
+                inv[i][k] = inv[j][k];
+                inv[j][k] = f;
+            }
         }
-        p[k] = in[i];
-        k++;
-        mask >>= 1;
-    }
-
-    for (i = 0; i < columns; i++)
-    {
         f = mtx[i][i];
         for (j = 0; j < columns; j++)
         {
@@ -146,32 +367,394 @@ uint32_t ida_rabin_merge(uint32_t size, uint32_t columns, uint32_t * rows, uint8
             }
         }
     }
-    off = 0;
-    for (f = 0; f < size; f++)
+}
+
+int32_t ida_rabin_setup(ida_rabin_t * rabin, uint32_t rows, uint32_t columns, bool systematic)
+{
+    uint8_t (* matrix)[columns];
+    uint32_t i, j, k, f;
+
+    if ((columns == 0) || (columns > IDA_RABIN_MAX_COLUMNS) ||
+        (rows < columns) || (rows > IDA_RABIN_MAX_ROWS))
+    {
+        return EINVAL;
+    }
+
+    memset(rabin, 0, sizeof(ida_rabin_t));
+    rabin->matrix = malloc(rows * columns);
+    rabin->encode = malloc(rows * sizeof(ida_rabin_row_t));
+    if ((rabin->matrix == NULL) || (rabin->encode == NULL))
+    {
+        ida_rabin_cleanup(rabin);
+
+        return ENOMEM;
+    }
+    rabin->rows = rows;
+    rabin->columns = columns;
+    rabin->systematic = systematic;
+
+    matrix = (uint8_t (*)[columns])rabin->matrix;
+
+    // Rabin's original dispersal matrix: row i is made of the powers of
+    // (i + 1). Any subset of 'columns' rows is invertible.
+    for (i = 0; i < rows; i++)
+    {
+        matrix[i][columns - 1] = 1;
+        for (j = columns - 1; j > 0; j--)
+        {
+            matrix[i][j - 1] = ida_rabin_mul(matrix[i][j], i + 1);
+        }
+    }
+
+    // The systematic version is obtained multiplying the whole matrix by the
+    // inverse of its first 'columns' rows. This converts them into the
+    // identity while preserving the invertibility of any subset of rows.
+    if (systematic)
+    {
+        uint8_t mtx[columns][columns];
+        uint8_t inv[columns][columns];
+
+        memcpy(mtx, matrix, columns * columns);
+        ida_rabin_invert(columns, mtx, inv);
+        for (i = 0; i < rows; i++)
+        {
+            memcpy(mtx[0], matrix[i], columns);
+            for (j = 0; j < columns; j++)
+            {
+                f = 0;
+                for (k = 0; k < columns; k++)
+                {
+                    f ^= ida_rabin_mul(mtx[0][k], inv[k][j]);
+                }
+                matrix[i][j] = f;
+            }
+        }
+    }
+
+    for (i = 0; i < rows; i++)
     {
+        ida_rabin_row_build(&rabin->encode[i], matrix[i], columns);
+    }
+
+    return 0;
+}
+
+void ida_rabin_cleanup(ida_rabin_t * rabin)
+{
+    free(rabin->matrix);
+    free(rabin->encode);
+    rabin->matrix = NULL;
+    rabin->encode = NULL;
+}
+
+// Computes 'count' rows of a matrix product over 'groups' groups. Blocks of
+// input data are processed for all rows before moving to the next block, so
+// inputs are only read once from memory.
+static void ida_rabin_apply(uint32_t groups, uint32_t columns, uint32_t count,
+                            ida_rabin_row_t ** rows, uint8_t ** in,
+                            uint32_t in_stride, uint8_t ** out,
+                            uint32_t out_stride)
+{
+    const ida_rabin_backend_t * backend;
+    uint8_t * ptrs[IDA_RABIN_MAX_COLUMNS];
+    uint32_t i, j, block, size, wide;
+
+    backend = ida_rabin_backend;
+
+    block = IDA_RABIN_BLOCK / (IDA_RABIN_GROUP * columns);
+    block -= block % backend->groups;
+    if (block < backend->groups)
+    {
+        block = backend->groups;
+    }
+
+    for (j = 0; j < groups; j += size)
+    {
+        size = groups - j;
+        if (size > block)
+        {
+            size = block;
+        }
+        wide = size - size % backend->groups;
+
         for (i = 0; i < columns; i++)
         {
-            ida_gf_load(p[0] + off);
-            j = 0;
-            while (j < columns)
+            ptrs[i] = in[i] + j * in_stride;
+        }
+        for (i = 0; i < count; i++)
+        {
+            if (wide > 0)
+            {
+                backend->apply(wide, columns, rows[i], ptrs, in_stride,
+                               out[i] + j * out_stride, out_stride);
+            }
+            if (wide < size)
             {
-                k = j + 1;
-                while (inv[i][k] == 0)
+                uint8_t * tmp[columns];
+                uint32_t k;
+
+                for (k = 0; k < columns; k++)
                 {
-                    k++;
+                    tmp[k] = ptrs[k] + wide * in_stride;
                 }
-                ida_gf_mul_table[ida_rabin_div(inv[i][j], inv[i][k])]();
-                if (k < columns)
+                ida_rabin_apply_sse2(size - wide, columns, rows[i], tmp,
+                                     in_stride,
+                                     out[i] + (j + wide) * out_stride,
+                                     out_stride);
+            }
+        }
+    }
+}
+
+uint32_t ida_rabin_split_multi(ida_rabin_t * rabin, uint32_t size, uint32_t count, uint32_t * rows, uint8_t * in, uint8_t ** out)
+{
+    ida_rabin_row_t * encode[count];
+    uint8_t * ptrs[IDA_RABIN_MAX_COLUMNS];
+    uint32_t i, groups, columns;
+
+    columns = rabin->columns;
+    groups = size / (IDA_RABIN_GROUP * columns);
+
+    for (i = 0; i < columns; i++)
+    {
+        ptrs[i] = in + i * IDA_RABIN_GROUP;
+    }
+    for (i = 0; i < count; i++)
+    {
+        encode[i] = &rabin->encode[rows[i]];
+    }
+
+    ida_rabin_apply(groups, columns, count, encode, ptrs,
+                    IDA_RABIN_GROUP * columns, out, IDA_RABIN_GROUP);
+
+    return groups * IDA_RABIN_GROUP;
+}
+
+uint32_t ida_rabin_split(ida_rabin_t * rabin, uint32_t size, uint32_t row, uint8_t * in, uint8_t * out)
+{
+    return ida_rabin_split_multi(rabin, size, 1, &row, in, &out);
+}
+
+static void ida_rabin_matrix_put(ida_rabin_matrix_t * matrix)
+{
+    if (__atomic_sub_fetch(&matrix->refs, 1, __ATOMIC_SEQ_CST) == 0)
+    {
+        free(matrix);
+    }
+}
+
+static ida_rabin_matrix_t * ida_rabin_matrix_get(ida_rabin_t * rabin,
+                                                 uint32_t * rows,
+                                                 uint64_t targets)
+{
+    ida_rabin_matrix_t * matrix, ** entry;
+    uint64_t mask, tmp;
+    uint32_t i, j, k, row, count, columns;
+
+    columns = rabin->columns;
+    count = (targets == 0) ? columns : __builtin_popcountll(targets);
+
+    mask = 0;
+    for (i = 0; i < columns; i++)
+    {
+        mask |= 1ULL << rows[i];
+    }
+    entry = &ida_rabin_cache[((mask * 0x9E3779B97F4A7C15ULL) +
+                              (targets * 0xC2B2AE3D27D4EB4FULL) + columns +
+                              rabin->systematic) >>
+                             (64 - IDA_RABIN_CACHE_BITS)];
+
+    pthread_rwlock_rdlock(&ida_rabin_cache_lock);
+    matrix = *entry;
+    if ((matrix != NULL) && (matrix->mask == mask) &&
+        (matrix->targets == targets) && (matrix->columns == columns) &&
+        (matrix->systematic == rabin->systematic))
+    {
+        __atomic_add_fetch(&matrix->refs, 1, __ATOMIC_SEQ_CST);
+        pthread_rwlock_unlock(&ida_rabin_cache_lock);
+
+        return matrix;
+    }
+    pthread_rwlock_unlock(&ida_rabin_cache_lock);
+
+    matrix = malloc(sizeof(ida_rabin_matrix_t) +
+                    sizeof(ida_rabin_row_t) * count);
+    if (matrix == NULL)
+    {
+        return NULL;
+    }
+
+    {
+        uint8_t (* src)[columns] = (uint8_t (*)[columns])rabin->matrix;
+        uint8_t mtx[columns][columns];
+        uint8_t inv[columns][columns];
+
+        for (i = 0; i < columns; i++)
+        {
+            memcpy(mtx[i], src[rows[i]], columns);
+        }
+        ida_rabin_invert(columns, mtx, inv);
+
+        // Precompute the multiplication chain of each row so that decoding
+        // does not need to do any division nor skip null coefficients.
+        if (targets == 0)
+        {
+            for (i = 0; i < columns; i++)
+            {
+                ida_rabin_row_build(&matrix->rows[i], inv[i], columns);
+            }
+        }
+        else
+        {
+            uint8_t coef[columns];
+
+            // The fragment of a target row is its encoding row applied to
+            // the decoded data, so the product of that row and the inverse
+            // matrix computes it directly from the source fragments.
+            tmp = targets;
+            for (i = 0; i < count; i++)
+            {
+                row = __builtin_ctzll(tmp);
+                tmp &= tmp - 1;
+                memset(coef, 0, columns);
+                for (j = 0; j < columns; j++)
                 {
-                    ida_gf_xor(p[k] + off);
+                    for (k = 0; k < columns; k++)
+                    {
+                        coef[k] ^= ida_rabin_mul(src[row][j], inv[j][k]);
+                    }
                 }
-                j = k;
+                ida_rabin_row_build(&matrix->rows[i], coef, columns);
             }
-            ida_gf_store(out);
-            out += 16 * IDA_RABIN_BITS;
         }
-        off += 16 * IDA_RABIN_BITS;
     }
+    matrix->mask = mask;
+    matrix->targets = targets;
+    matrix->columns = columns;
+    matrix->systematic = rabin->systematic;
+    // One reference for the cache and another one for the caller.
+    matrix->refs = 2;
+
+    pthread_rwlock_wrlock(&ida_rabin_cache_lock);
+    if (*entry != NULL)
+    {
+        ida_rabin_matrix_put(*entry);
+    }
+    *entry = matrix;
+    pthread_rwlock_unlock(&ida_rabin_cache_lock);
+
+    return matrix;
+}
+
+uint32_t ida_rabin_merge(ida_rabin_t * rabin, uint32_t size, uint32_t * rows, uint8_t ** in, uint8_t * out)
+{
+    ida_rabin_matrix_t * matrix;
+    ida_rabin_row_t * decode[IDA_RABIN_MAX_COLUMNS];
+    uint32_t i, j, count, row, columns;
+    uint32_t sorted[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * p[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * o[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * ptr;
+
+    columns = rabin->columns;
+    count = size / IDA_RABIN_GROUP;
+
+    // The inverse matrix only depends on the set of fragments used, so they
+    // are sorted to get the same cache entry regardless of the order in which
+    // they have been received.
+    for (i = 0; i < columns; i++)
+    {
+        row = rows[i];
+        ptr = in[i];
+        for (j = i; (j > 0) && (sorted[j - 1] > row); j--)
+        {
+            sorted[j] = sorted[j - 1];
+            p[j] = p[j - 1];
+        }
+        sorted[j] = row;
+        p[j] = ptr;
+    }
+
+    // On a systematic code, the first 'columns' fragments contain the
+    // original data, so it only needs to be interleaved.
+    if (rabin->systematic && (sorted[columns - 1] == columns - 1))
+    {
+        for (j = 0; j < count; j++)
+        {
+            for (i = 0; i < columns; i++)
+            {
+                memcpy(out, p[i], IDA_RABIN_GROUP);
+                p[i] += IDA_RABIN_GROUP;
+                out += IDA_RABIN_GROUP;
+            }
+        }
+
+        return count * IDA_RABIN_GROUP * columns;
+    }
+
+    matrix = ida_rabin_matrix_get(rabin, sorted, 0);
+    if (matrix == NULL)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < columns; i++)
+    {
+        decode[i] = &matrix->rows[i];
+        o[i] = out + i * IDA_RABIN_GROUP;
+    }
+
+    ida_rabin_apply(count, columns, columns, decode, p, IDA_RABIN_GROUP, o,
+                    IDA_RABIN_GROUP * columns);
+
+    ida_rabin_matrix_put(matrix);
+
+    return count * IDA_RABIN_GROUP * columns;
+}
+
+uint32_t ida_rabin_regenerate(ida_rabin_t * rabin, uint32_t size, uint32_t * rows, uint8_t ** in, uint64_t targets, uint8_t ** out)
+{
+    ida_rabin_matrix_t * matrix;
+    ida_rabin_row_t * combine[IDA_RABIN_MAX_ROWS];
+    uint32_t i, j, count, row, columns;
+    uint32_t sorted[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * p[IDA_RABIN_MAX_COLUMNS];
+    uint8_t * ptr;
+
+    columns = rabin->columns;
+    count = size / IDA_RABIN_GROUP;
+
+    for (i = 0; i < columns; i++)
+    {
+        row = rows[i];
+        ptr = in[i];
+        for (j = i; (j > 0) && (sorted[j - 1] > row); j--)
+        {
+            sorted[j] = sorted[j - 1];
+            p[j] = p[j - 1];
+        }
+        sorted[j] = row;
+        p[j] = ptr;
+    }
+
+    matrix = ida_rabin_matrix_get(rabin, sorted, targets);
+    if (matrix == NULL)
+    {
+        return 0;
+    }
+
+    j = __builtin_popcountll(targets);
+    for (i = 0; i < j; i++)
+    {
+        combine[i] = &matrix->rows[i];
+    }
+
+    // Fragments have the same layout in all rows, so each group of a target
+    // fragment only depends on the same group of the source fragments.
+    ida_rabin_apply(count, columns, j, combine, p, IDA_RABIN_GROUP, out,
+                    IDA_RABIN_GROUP);
+
+    ida_rabin_matrix_put(matrix);
 
-    return size * 16 * IDA_RABIN_BITS * columns;
+    return count * IDA_RABIN_GROUP;
 }
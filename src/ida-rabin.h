@@ -21,13 +21,49 @@
 #ifndef __IDA_RABIN_H__
 #define __IDA_RABIN_H__
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "ida-gf.h"
 
 #define IDA_RABIN_BITS IDA_GF_BITS
 #define IDA_RABIN_SIZE (1 << (IDA_RABIN_BITS))
 
+// Rows are identified by a bit in a 64 bits mask, and at least one of them
+// must be redundant.
+#define IDA_RABIN_MAX_ROWS 64
+#define IDA_RABIN_MAX_COLUMNS (IDA_RABIN_MAX_ROWS - 1)
+
+// Sequence of operations needed to compute one row of a matrix product: the
+// source 'first' is loaded and then, for each step, the accumulated value is
+// multiplied by 'factor' and the source 'source' is xored into it. The last
+// step always has 'source' == columns, meaning that there is nothing else to
+// xor.
+typedef struct
+{
+    uint8_t first;
+    uint8_t count;
+    uint8_t factor[IDA_RABIN_MAX_COLUMNS + 1];
+    uint8_t source[IDA_RABIN_MAX_COLUMNS + 1];
+} ida_rabin_row_t;
+
+typedef struct
+{
+    uint32_t          rows;
+    uint32_t          columns;
+    bool              systematic;
+    uint8_t *         matrix;
+    ida_rabin_row_t * encode;
+} ida_rabin_t;
+
 void ida_rabin_initialize(void);
-uint32_t ida_rabin_split(uint32_t size, uint32_t columns, uint32_t row, uint8_t * in, uint8_t * out);
-uint32_t ida_rabin_merge(uint32_t size, uint32_t columns, uint32_t * rows, uint8_t ** in, uint8_t * out);
+const char * ida_rabin_backend_name(void);
+int32_t ida_rabin_backend_select(const char * name);
+int32_t ida_rabin_setup(ida_rabin_t * rabin, uint32_t rows, uint32_t columns, bool systematic);
+void ida_rabin_cleanup(ida_rabin_t * rabin);
+uint32_t ida_rabin_split(ida_rabin_t * rabin, uint32_t size, uint32_t row, uint8_t * in, uint8_t * out);
+uint32_t ida_rabin_split_multi(ida_rabin_t * rabin, uint32_t size, uint32_t count, uint32_t * rows, uint8_t * in, uint8_t ** out);
+uint32_t ida_rabin_merge(ida_rabin_t * rabin, uint32_t size, uint32_t * rows, uint8_t ** in, uint8_t * out);
+uint32_t ida_rabin_regenerate(ida_rabin_t * rabin, uint32_t size, uint32_t * rows, uint8_t ** in, uint64_t targets, uint8_t ** out);
 
 #endif /* __IDA_RABIN_H__ */
@@ -0,0 +1,237 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include "statedump.h"
+
+#include "ida-common.h"
+#include "ida-mem-types.h"
+#include "ida-stats.h"
+
+#define IDA_STATS_FOP_NAME(_fop) #_fop,
+
+static const char * ida_stats_fop_names[IDA_FOP_ID_COUNT] =
+{
+    IDA_STATS_FOPS(IDA_STATS_FOP_NAME)
+};
+
+static const char * ida_stats_counter_names[IDA_STATS_COUNTERS] =
+{
+    [IDA_STATS_ENCODED]        = "encoded_bytes",
+    [IDA_STATS_ENCODE_TIME]    = "encode_usecs",
+    [IDA_STATS_DECODED]        = "decoded_bytes",
+    [IDA_STATS_DECODE_TIME]    = "decode_usecs",
+    [IDA_STATS_RMW_READS]      = "rmw_reads",
+    [IDA_STATS_HEALS_STARTED]  = "heals_started",
+    [IDA_STATS_HEALS_FINISHED] = "heals_finished",
+    [IDA_STATS_HEAL_HOLES]     = "heal_hole_bytes",
+    [IDA_STATS_HEAL_CLEAN]     = "heal_clean_bytes",
+    [IDA_STATS_DIRTY_MARKS]    = "dirty_marks",
+    [IDA_STATS_CRAWL_ENTRIES]  = "crawl_entries",
+    [IDA_STATS_CRAWLS_FINISHED] = "crawls_finished"
+};
+
+static ida_stats_shard_t * ida_stats_shard(ida_stats_t * stats)
+{
+    return &stats->shards[ida_thread_index() % IDA_STATS_SHARDS];
+}
+
+const char * ida_stats_fop_name(int32_t fop)
+{
+    return ida_stats_fop_names[fop];
+}
+
+static uint32_t ida_stats_bucket(uint64_t elapsed)
+{
+    uint32_t bucket;
+
+    if (elapsed == 0)
+    {
+        return 0;
+    }
+
+    bucket = 64 - __builtin_clzll(elapsed);
+    if (bucket >= IDA_STATS_BUCKETS)
+    {
+        bucket = IDA_STATS_BUCKETS - 1;
+    }
+
+    return bucket;
+}
+
+err_t ida_stats_initialize(ida_stats_t * stats, uint32_t nodes)
+{
+    stats->nodes = nodes;
+
+    SYS_ALLOC_ALIGNED(
+        &stats->shards, IDA_STATS_SHARDS * sizeof(ida_stats_shard_t), 64,
+        ida_mt_ida_stats_t,
+        E(),
+        RETERR()
+    );
+    memset(stats->shards, 0, IDA_STATS_SHARDS * sizeof(ida_stats_shard_t));
+
+    return 0;
+}
+
+void ida_stats_terminate(ida_stats_t * stats)
+{
+    if (stats->shards != NULL)
+    {
+        SYS_FREE_ALIGNED(stats->shards);
+        stats->shards = NULL;
+    }
+}
+
+void ida_stats_fop(ida_stats_t * stats, int32_t fop, uint64_t elapsed,
+                   bool failed, uint64_t bytes)
+{
+    ida_stats_fop_t * data;
+
+    data = &ida_stats_shard(stats)->fops[fop];
+
+    atomic_inc(&data->calls, memory_order_relaxed);
+    if (failed)
+    {
+        atomic_inc(&data->errors, memory_order_relaxed);
+    }
+    if (bytes > 0)
+    {
+        atomic_add(&data->bytes, bytes, memory_order_relaxed);
+    }
+    atomic_inc(&data->latency[ida_stats_bucket(elapsed)],
+               memory_order_relaxed);
+}
+
+void ida_stats_child(ida_stats_t * stats, int32_t idx, uint64_t elapsed,
+                     bool failed)
+{
+    ida_stats_child_t * data;
+
+    data = &ida_stats_shard(stats)->childs[idx];
+
+    atomic_inc(&data->answers, memory_order_relaxed);
+    if (failed)
+    {
+        atomic_inc(&data->errors, memory_order_relaxed);
+    }
+    atomic_inc(&data->latency[ida_stats_bucket(elapsed)],
+               memory_order_relaxed);
+}
+
+void ida_stats_add(ida_stats_t * stats, int32_t counter, uint64_t value)
+{
+    atomic_add(&ida_stats_shard(stats)->counters[counter], value,
+               memory_order_relaxed);
+}
+
+static void ida_stats_dump_latency(const char * key, uint64_t * latency)
+{
+    char buffer[IDA_STATS_BUCKETS * 21 + 1];
+    int32_t i, length;
+
+    length = 0;
+    for (i = 0; i < IDA_STATS_BUCKETS; i++)
+    {
+        length += snprintf(buffer + length, sizeof(buffer) - length,
+                           (i == 0) ? "%" PRIu64 : " %" PRIu64, latency[i]);
+    }
+    gf_proc_dump_write((char *)key, "%s", buffer);
+}
+
+// Shards are added without any lock, so the dumped values may not be
+// completely coherent between them.
+void ida_stats_dump(ida_stats_t * stats, xlator_t * xl)
+{
+    ida_stats_fop_t fop;
+    ida_stats_child_t child;
+    uint64_t counters[IDA_STATS_COUNTERS];
+    char key[GF_DUMP_MAX_BUF_LEN];
+    int32_t i, j, k;
+
+    if (stats->shards == NULL)
+    {
+        return;
+    }
+
+    memset(counters, 0, sizeof(counters));
+    for (i = 0; i < IDA_STATS_SHARDS; i++)
+    {
+        for (j = 0; j < IDA_STATS_COUNTERS; j++)
+        {
+            counters[j] += stats->shards[i].counters[j];
+        }
+    }
+    for (j = 0; j < IDA_STATS_COUNTERS; j++)
+    {
+        gf_proc_dump_write((char *)ida_stats_counter_names[j], "%" PRIu64,
+                           counters[j]);
+    }
+
+    for (j = 0; j < IDA_FOP_ID_COUNT; j++)
+    {
+        memset(&fop, 0, sizeof(fop));
+        for (i = 0; i < IDA_STATS_SHARDS; i++)
+        {
+            fop.calls += stats->shards[i].fops[j].calls;
+            fop.errors += stats->shards[i].fops[j].errors;
+            fop.bytes += stats->shards[i].fops[j].bytes;
+            for (k = 0; k < IDA_STATS_BUCKETS; k++)
+            {
+                fop.latency[k] += stats->shards[i].fops[j].latency[k];
+            }
+        }
+        if (fop.calls == 0)
+        {
+            continue;
+        }
+
+        snprintf(key, sizeof(key), "fop.%s.calls", ida_stats_fop_names[j]);
+        gf_proc_dump_write(key, "%" PRIu64, fop.calls);
+        snprintf(key, sizeof(key), "fop.%s.errors", ida_stats_fop_names[j]);
+        gf_proc_dump_write(key, "%" PRIu64, fop.errors);
+        snprintf(key, sizeof(key), "fop.%s.bytes", ida_stats_fop_names[j]);
+        gf_proc_dump_write(key, "%" PRIu64, fop.bytes);
+        snprintf(key, sizeof(key), "fop.%s.latency", ida_stats_fop_names[j]);
+        ida_stats_dump_latency(key, fop.latency);
+    }
+
+    for (j = 0; j < stats->nodes; j++)
+    {
+        memset(&child, 0, sizeof(child));
+        for (i = 0; i < IDA_STATS_SHARDS; i++)
+        {
+            child.answers += stats->shards[i].childs[j].answers;
+            child.errors += stats->shards[i].childs[j].errors;
+            for (k = 0; k < IDA_STATS_BUCKETS; k++)
+            {
+                child.latency[k] += stats->shards[i].childs[j].latency[k];
+            }
+        }
+
+        snprintf(key, sizeof(key), "child[%d].answers", j);
+        gf_proc_dump_write(key, "%" PRIu64, child.answers);
+        snprintf(key, sizeof(key), "child[%d].errors", j);
+        gf_proc_dump_write(key, "%" PRIu64, child.errors);
+        snprintf(key, sizeof(key), "child[%d].answer_latency", j);
+        ida_stats_dump_latency(key, child.latency);
+    }
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_STATS_H__
+#define __IDA_STATS_H__
+
+#include "xlator.h"
+
+#include "ida-rabin.h"
+
+// Latencies are accounted in buckets of exponentially increasing size. Bucket
+// 0 holds latencies smaller than 1 microsecond and bucket N, latencies
+// between 2^(N-1) and 2^N - 1 microseconds. The last bucket also holds all
+// bigger latencies.
+#define IDA_STATS_BUCKETS 24
+
+// Statistics are kept in several independent shards. Each thread always
+// updates the same shard, so threads rarely compete for the same counters.
+#define IDA_STATS_SHARDS 16
+
+#define IDA_STATS_FOPS(_macro) \
+    _macro(access) _macro(create) _macro(entrylk) _macro(fentrylk) \
+    _macro(flush) _macro(fsync) _macro(fsyncdir) _macro(getxattr) \
+    _macro(fgetxattr) _macro(inodelk) _macro(finodelk) _macro(link) \
+    _macro(lk) _macro(lookup) _macro(mkdir) _macro(mknod) _macro(open) \
+    _macro(opendir) _macro(rchecksum) _macro(readdir) _macro(readdirp) \
+    _macro(readlink) _macro(readv) _macro(removexattr) \
+    _macro(fremovexattr) _macro(rename) _macro(rmdir) _macro(setattr) \
+    _macro(fsetattr) _macro(setxattr) _macro(fsetxattr) _macro(stat) \
+    _macro(fstat) _macro(statfs) _macro(symlink) _macro(truncate) \
+    _macro(ftruncate) _macro(unlink) _macro(writev) _macro(xattrop) \
+    _macro(fxattrop)
+
+#define IDA_STATS_FOP_ID(_fop) IDA_FOP_ID_##_fop,
+
+enum
+{
+    IDA_STATS_FOPS(IDA_STATS_FOP_ID)
+    IDA_FOP_ID_COUNT
+};
+
+enum
+{
+    IDA_STATS_ENCODED,
+    IDA_STATS_ENCODE_TIME,
+    IDA_STATS_DECODED,
+    IDA_STATS_DECODE_TIME,
+    IDA_STATS_RMW_READS,
+    IDA_STATS_HEALS_STARTED,
+    IDA_STATS_HEALS_FINISHED,
+    IDA_STATS_HEAL_HOLES,
+    IDA_STATS_HEAL_CLEAN,
+    IDA_STATS_DIRTY_MARKS,
+    IDA_STATS_CRAWL_ENTRIES,
+    IDA_STATS_CRAWLS_FINISHED,
+    IDA_STATS_COUNTERS
+};
+
+typedef struct
+{
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t bytes;
+    uint64_t latency[IDA_STATS_BUCKETS];
+} ida_stats_fop_t;
+
+typedef struct
+{
+    uint64_t answers;
+    uint64_t errors;
+    uint64_t latency[IDA_STATS_BUCKETS];
+} ida_stats_child_t;
+
+typedef struct
+{
+    ida_stats_fop_t   fops[IDA_FOP_ID_COUNT];
+    ida_stats_child_t childs[IDA_RABIN_MAX_ROWS];
+    uint64_t          counters[IDA_STATS_COUNTERS];
+} __attribute__((aligned(64))) ida_stats_shard_t;
+
+typedef struct
+{
+    ida_stats_shard_t * shards;
+    uint32_t            nodes;
+} ida_stats_t;
+
+err_t ida_stats_initialize(ida_stats_t * stats, uint32_t nodes);
+void ida_stats_terminate(ida_stats_t * stats);
+
+void ida_stats_fop(ida_stats_t * stats, int32_t fop, uint64_t elapsed,
+                   bool failed, uint64_t bytes);
+void ida_stats_child(ida_stats_t * stats, int32_t idx, uint64_t elapsed,
+                     bool failed);
+void ida_stats_add(ida_stats_t * stats, int32_t counter, uint64_t value);
+
+void ida_stats_dump(ida_stats_t * stats, xlator_t * xl);
+
+const char * ida_stats_fop_name(int32_t fop);
+
+#endif /* __IDA_STATS_H__ */
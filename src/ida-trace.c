@@ -0,0 +1,163 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include "statedump.h"
+
+#include "ida-common.h"
+#include "ida-mem-types.h"
+#include "ida-stats.h"
+#include "ida-trace.h"
+
+static const char * ida_trace_event_names[IDA_TRACE_EVENTS] =
+{
+    [IDA_TRACE_START]   = "start",
+    [IDA_TRACE_SEND]    = "send",
+    [IDA_TRACE_QUEUE]   = "queue",
+    [IDA_TRACE_HEDGE]   = "hedge",
+    [IDA_TRACE_ANSWER]  = "answer",
+    [IDA_TRACE_QUORUM]  = "quorum",
+    [IDA_TRACE_REBUILT] = "rebuilt",
+    [IDA_TRACE_UNWIND]  = "unwind",
+    [IDA_TRACE_HEAL]    = "heal",
+    [IDA_TRACE_DESTROY] = "destroy"
+};
+
+// 'size' is the number of events kept in each ring. It's rounded up to a
+// power of two. 0 disables tracing.
+err_t ida_trace_initialize(ida_trace_t * trace, uint32_t size)
+{
+    int32_t i;
+
+    trace->rings = NULL;
+    trace->entries = NULL;
+    trace->size = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    trace->size = 1;
+    while (trace->size < size)
+    {
+        trace->size <<= 1;
+    }
+
+    SYS_CALLOC0(
+        &trace->entries, IDA_TRACE_RINGS * trace->size,
+        ida_mt_ida_trace_t,
+        E(),
+        RETERR()
+    );
+    SYS_ALLOC_ALIGNED(
+        &trace->rings, IDA_TRACE_RINGS * sizeof(ida_trace_ring_t), 64,
+        ida_mt_ida_trace_t,
+        E(),
+        GOTO(failed)
+    );
+    for (i = 0; i < IDA_TRACE_RINGS; i++)
+    {
+        trace->rings[i].head = 0;
+        trace->rings[i].entries = trace->entries + i * trace->size;
+    }
+
+    return 0;
+
+failed:
+    SYS_FREE(trace->entries);
+    trace->entries = NULL;
+
+    return ENOMEM;
+}
+
+void ida_trace_terminate(ida_trace_t * trace)
+{
+    if (trace->rings != NULL)
+    {
+        SYS_FREE_ALIGNED(trace->rings);
+        trace->rings = NULL;
+    }
+    if (trace->entries != NULL)
+    {
+        SYS_FREE(trace->entries);
+        trace->entries = NULL;
+    }
+}
+
+// Each event takes its own entry, even if more than one thread uses the same
+// ring. An entry can only be overwritten while it's being filled if the ring
+// wraps around in the meantime.
+void ida_trace_event(ida_trace_t * trace, uintptr_t req, int32_t fop,
+                     int32_t event, int32_t idx, int32_t value)
+{
+    ida_trace_ring_t * ring;
+    ida_trace_entry_t * entry;
+    uint64_t pos;
+
+    ring = &trace->rings[ida_thread_index() % IDA_TRACE_RINGS];
+    pos = atomic_inc(&ring->head, memory_order_relaxed);
+    entry = &ring->entries[pos & (trace->size - 1)];
+
+    entry->req = req;
+    entry->value = value;
+    entry->idx = idx;
+    entry->fop = fop;
+    entry->event = event;
+    entry->time = ida_time_now();
+}
+
+// Events are dumped from the oldest to the newest of each ring. Entries that
+// are being written during the dump may appear incomplete.
+void ida_trace_dump(ida_trace_t * trace, xlator_t * xl)
+{
+    ida_trace_ring_t * ring;
+    ida_trace_entry_t entry;
+    char key[GF_DUMP_MAX_BUF_LEN];
+    uint64_t head, pos;
+    int32_t i;
+
+    if (trace->rings == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < IDA_TRACE_RINGS; i++)
+    {
+        ring = &trace->rings[i];
+        head = atomic_add(&ring->head, 0, memory_order_seq_cst);
+        pos = (head > trace->size) ? head - trace->size : 0;
+
+        snprintf(key, sizeof(key), "trace[%d]", i);
+        for (; pos < head; pos++)
+        {
+            entry = ring->entries[pos & (trace->size - 1)];
+            if ((entry.time == 0) || (entry.event >= IDA_TRACE_EVENTS))
+            {
+                continue;
+            }
+            gf_proc_dump_write(key, "%" PRIu64 " %p %s %s %d %d", entry.time,
+                               (void *)entry.req, ida_stats_fop_name(entry.fop),
+                               ida_trace_event_names[entry.event], entry.idx,
+                               entry.value);
+        }
+    }
+}
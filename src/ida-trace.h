@@ -0,0 +1,90 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_TRACE_H__
+#define __IDA_TRACE_H__
+
+#include "xlator.h"
+
+// Events are recorded in several independent rings. Each thread always
+// writes to the same ring, so threads rarely compete for the same entries.
+#define IDA_TRACE_RINGS 16
+
+enum
+{
+    IDA_TRACE_START,
+    IDA_TRACE_SEND,
+    IDA_TRACE_QUEUE,
+    IDA_TRACE_HEDGE,
+    IDA_TRACE_ANSWER,
+    IDA_TRACE_QUORUM,
+    IDA_TRACE_REBUILT,
+    IDA_TRACE_UNWIND,
+    IDA_TRACE_HEAL,
+    IDA_TRACE_DESTROY,
+    IDA_TRACE_EVENTS
+};
+
+// 'idx' is the subvolume involved in the event, or -1. The meaning of
+// 'value' depends on the event.
+typedef struct
+{
+    uint64_t  time;
+    uintptr_t req;
+    int32_t   value;
+    int16_t   idx;
+    uint8_t   fop;
+    uint8_t   event;
+} ida_trace_entry_t;
+
+typedef struct
+{
+    uint64_t            head;
+    ida_trace_entry_t * entries;
+} __attribute__((aligned(64))) ida_trace_ring_t;
+
+typedef struct
+{
+    ida_trace_ring_t *  rings;
+    ida_trace_entry_t * entries;
+    uint32_t            size;
+} ida_trace_t;
+
+// Tracing is disabled when no rings have been allocated. In this case the
+// cost of an event is a single comparison.
+#define IDA_TRACE(_ida, _req, _event, _idx, _value) \
+    do \
+    { \
+        if ((_ida)->trace.rings != NULL) \
+        { \
+            ida_trace_event(&(_ida)->trace, (uintptr_t)(_req), \
+                            (_req)->fop, IDA_TRACE_##_event, _idx, _value); \
+        } \
+    } while (0)
+
+err_t ida_trace_initialize(ida_trace_t * trace, uint32_t size);
+void ida_trace_terminate(ida_trace_t * trace);
+
+void ida_trace_event(ida_trace_t * trace, uintptr_t req, int32_t fop,
+                     int32_t event, int32_t idx, int32_t value);
+
+void ida_trace_dump(ida_trace_t * trace, xlator_t * xl);
+
+#endif /* __IDA_TRACE_H__ */
@@ -20,6 +20,7 @@
 
 #include "gfsys.h"
 
+#include "ida-common.h"
 #include "ida.h"
 
 //static uint32_t dict_count = 0;
@@ -27,7 +28,8 @@
 int32_t ida_dict_special(char * key)
 {
     return /*(strcmp(key, IDA_KEY_VERSION) == 0) ||*/
-           (strcmp(key, GF_CONTENT_KEY) == 0);
+           (strcmp(key, GF_CONTENT_KEY) == 0) ||
+           (strcmp(key, IDA_KEY_DIRTY) == 0);
 }
 
 int32_t ida_dict_data_compare(data_t * dst, data_t * src)
@@ -138,6 +140,47 @@ int ida_dict_compare_enum(dict_t * src, char * key, data_t * value, void * arg)
     return 0;
 }
 
+int ida_dict_hash_enum(dict_t * src, char * key, data_t * value, void * arg)
+{
+    uint64_t * hash;
+    uint64_t item;
+
+    hash = arg;
+
+    item = ida_hash_buffer(IDA_HASH_INIT, key, strlen(key));
+    if (ida_dict_special(key))
+    {
+        item = ida_hash_buffer(item, &value->len, sizeof(value->len));
+    }
+    else
+    {
+        item = ida_hash_buffer(item, value->data, value->len);
+    }
+
+    // Items can be enumerated in any order, so their hashes are combined with
+    // a commutative operation.
+    *hash += item;
+
+    return 0;
+}
+
+// Two dictionaries that ida_dict_compare() considers equal always have the
+// same hash.
+uint64_t ida_dict_hash(dict_t * dict)
+{
+    uint64_t hash;
+
+    if (dict == NULL)
+    {
+        return 0;
+    }
+
+    hash = dict->count;
+    dict_foreach(dict, ida_dict_hash_enum, &hash);
+
+    return hash;
+}
+
 bool ida_dict_compare(dict_t * dst, dict_t * src)
 {
     if ((dst == NULL) || (src == NULL))
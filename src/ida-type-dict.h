@@ -25,5 +25,6 @@
 
 bool ida_dict_combine(dict_t ** dst, dict_t * src);
 bool ida_dict_compare(dict_t * dst, dict_t * src);
+uint64_t ida_dict_hash(dict_t * dict);
 
 #endif /* __IDA_DICT_H__ */
@@ -20,6 +20,7 @@
 
 #include "gfsys.h"
 
+#include "ida-common.h"
 #include "ida-manager.h"
 #include "ida-type-dict.h"
 #include "ida.h"
@@ -33,6 +34,31 @@ void ida_iatt_time_merge(uint32_t * dst_sec, uint32_t * dst_nsec, uint32_t src_s
     }
 }
 
+// Hash of the fields that ida_iatt_combine() requires to be equal. Times and
+// block counts are merged, so they are not included.
+uint64_t ida_iatt_hash(struct iatt * iatt)
+{
+    uint64_t hash;
+    uint32_t mode;
+
+    mode = st_mode_from_ia(iatt->ia_prot, iatt->ia_type);
+
+    hash = IDA_HASH_INIT;
+    hash = ida_hash_buffer(hash, iatt->ia_gfid, sizeof(iatt->ia_gfid));
+    hash = ida_hash_buffer(hash, &iatt->ia_ino, sizeof(iatt->ia_ino));
+    hash = ida_hash_buffer(hash, &mode, sizeof(mode));
+    hash = ida_hash_buffer(hash, &iatt->ia_uid, sizeof(iatt->ia_uid));
+    hash = ida_hash_buffer(hash, &iatt->ia_gid, sizeof(iatt->ia_gid));
+    hash = ida_hash_buffer(hash, &iatt->ia_rdev, sizeof(iatt->ia_rdev));
+    if (iatt->ia_type == IA_IFREG)
+    {
+        hash = ida_hash_buffer(hash, &iatt->ia_size,
+                                   sizeof(iatt->ia_size));
+    }
+
+    return hash;
+}
+
 bool ida_iatt_combine(struct iatt * dst, struct iatt * src1,
                       struct iatt * src2)
 {
@@ -27,6 +27,7 @@
 
 bool ida_iatt_combine(struct iatt * dst, struct iatt * src1,
                       struct iatt * src2);
+uint64_t ida_iatt_hash(struct iatt * iatt);
 void ida_iatt_adjust(ida_local_t * local, struct iatt * dst, dict_t * xattr,
                      inode_t * inode);
 void ida_iatt_rebuild(ida_private_t * ida, struct iatt * iatt, int32_t count);
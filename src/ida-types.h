@@ -27,6 +27,9 @@ typedef struct _ida_local ida_local_t;
 typedef union _ida_args ida_args_t;
 typedef struct _ida_args_cbk ida_args_cbk_t;
 
+// Number of counters of modified regions kept for each inode.
+#define IDA_DIRTY_SLOTS 64
+
 typedef struct _ida_heal
 {
     int32_t refs;
@@ -42,10 +45,13 @@ typedef struct _ida_heal
     uintptr_t open;
     struct iatt iatt;
     off_t offset;
+    uint64_t size;
+    int32_t inflight;
     loc_t loc;
     char * symlink;
     fd_t * fd_src;
     fd_t * fd_dst;
+    int32_t dirty[IDA_DIRTY_SLOTS];
 } ida_heal_t;
 
 typedef struct
@@ -88,12 +94,30 @@ typedef struct
     ida_heal_t heal;
 } ida_inode_ctx_t;
 
+// Sequential writes received through an fd that are kept in memory until
+// they can be sent to the bricks as a single bigger write.
 typedef struct
 {
-    uintptr_t mask;
-    uintptr_t data;
-    uint32_t  flags;
-    loc_t     loc;
+    gf_lock_t        lock;
+    gf_lock_t        pending_lock;
+    call_frame_t *   frame;
+    struct iobref *  iobref;
+    uint8_t *        data;
+    off_t            offset;
+    size_t           size;
+    uintptr_t *      delay;
+    int32_t          pending;
+    int32_t          error;
+    struct list_head waiting;
+} ida_coalesce_t;
+
+typedef struct
+{
+    uintptr_t      mask;
+    uintptr_t      data;
+    uint32_t       flags;
+    loc_t          loc;
+    ida_coalesce_t coalesce;
 } ida_fd_ctx_t;
 
 typedef void (* ida_manager_wipe_f)(ida_local_t * local);
@@ -0,0 +1,186 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include "gfsys.h"
+
+#include "ida-mem-types.h"
+#include "ida-worker.h"
+
+static void ida_worker_chunk(ida_worker_job_t * job, uint32_t index)
+{
+    job->chunk(job, index);
+
+    if (atomic_dec(&job->pending, memory_order_seq_cst) == 1)
+    {
+        job->done(job);
+    }
+}
+
+static void * ida_worker_thread(void * data)
+{
+    ida_worker_t * pool;
+    ida_worker_job_t * job;
+    uint32_t index;
+
+    pool = data;
+
+    // Completion of a job can wind new requests from this thread, so it must
+    // look like any other thread of the translator.
+    THIS = pool->xl;
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop)
+    {
+        if (list_empty(&pool->jobs))
+        {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+
+            continue;
+        }
+
+        job = list_entry(pool->jobs.next, ida_worker_job_t, list);
+        index = job->next++;
+        if (job->next >= job->count)
+        {
+            list_del_init(&job->list);
+        }
+        pthread_mutex_unlock(&pool->lock);
+
+        ida_worker_chunk(job, index);
+
+        pthread_mutex_lock(&pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// ida_worker_terminate() must be called even if the initialization fails.
+err_t ida_worker_initialize(ida_worker_t * pool, xlator_t * xl,
+                            uint32_t threads)
+{
+    err_t error;
+
+    pool->xl = xl;
+    pool->threads = NULL;
+    pool->count = 0;
+    pool->stop = false;
+    INIT_LIST_HEAD(&pool->jobs);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+
+    if (threads == 0)
+    {
+        return 0;
+    }
+
+    SYS_CALLOC0(
+        &pool->threads, threads, ida_mt_pthread_t,
+        E(),
+        RETERR()
+    );
+
+    for (pool->count = 0; pool->count < threads; pool->count++)
+    {
+        error = pthread_create(&pool->threads[pool->count], NULL,
+                               ida_worker_thread, pool);
+        if (error != 0)
+        {
+            logE("Unable to create coding threads (%d).", error);
+
+            return error;
+        }
+    }
+
+    return 0;
+}
+
+void ida_worker_terminate(ida_worker_t * pool)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->count; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pool->count = 0;
+
+    if (pool->threads != NULL)
+    {
+        SYS_FREE(pool->threads);
+        pool->threads = NULL;
+    }
+
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+// Starts the processing of a job. If there is no pool, or it does not have
+// any thread, all chunks are processed by the calling thread before
+// returning.
+void ida_worker_run(ida_worker_t * pool, ida_worker_job_t * job,
+                    uint32_t count, ida_worker_chunk_f chunk,
+                    ida_worker_done_f done)
+{
+    uint32_t i;
+
+    job->chunk = chunk;
+    job->done = done;
+    job->count = count;
+    job->next = 0;
+    job->pending = count;
+
+    if (count == 0)
+    {
+        done(job);
+
+        return;
+    }
+
+    if ((pool == NULL) || (pool->count == 0) || (count <= 1))
+    {
+        for (i = 0; i < count; i++)
+        {
+            ida_worker_chunk(job, i);
+        }
+
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    list_add_tail(&job->list, &pool->jobs);
+    if (count < pool->count)
+    {
+        for (i = 0; i < count; i++)
+        {
+            pthread_cond_signal(&pool->cond);
+        }
+    }
+    else
+    {
+        pthread_cond_broadcast(&pool->cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
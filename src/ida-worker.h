@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2012-2013 DataLab, S.L. <http://www.datalab.es>
+
+  This file is part of the cluster/ida translator for GlusterFS.
+
+  The cluster/ida translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ida translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ida translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __IDA_WORKER_H__
+#define __IDA_WORKER_H__
+
+#include <pthread.h>
+
+#include "list.h"
+#include "xlator.h"
+
+struct _ida_worker_job;
+typedef struct _ida_worker_job ida_worker_job_t;
+
+typedef void (* ida_worker_chunk_f)(ida_worker_job_t * job, uint32_t index);
+typedef void (* ida_worker_done_f)(ida_worker_job_t * job);
+
+// A job is made of 'count' independent chunks. Chunks are processed in any
+// order and by any thread. 'done' is called once, by the thread that
+// completes the last chunk. The job is normally embedded at the beginning of
+// a bigger structure holding all the needed data.
+struct _ida_worker_job
+{
+    struct list_head   list;
+    ida_worker_chunk_f chunk;
+    ida_worker_done_f  done;
+    uint32_t           count;
+    uint32_t           next;
+    uint32_t           pending;
+};
+
+typedef struct
+{
+    xlator_t *       xl;
+    pthread_mutex_t  lock;
+    pthread_cond_t   cond;
+    struct list_head jobs;
+    pthread_t *      threads;
+    uint32_t         count;
+    bool             stop;
+} ida_worker_t;
+
+err_t ida_worker_initialize(ida_worker_t * pool, xlator_t * xl,
+                            uint32_t threads);
+void ida_worker_terminate(ida_worker_t * pool);
+void ida_worker_run(ida_worker_t * pool, ida_worker_job_t * job,
+                    uint32_t count, ida_worker_chunk_f chunk,
+                    ida_worker_done_f done);
+
+#endif /* __IDA_WORKER_H__ */
@@ -22,17 +22,23 @@
 #include "gfdfc.h"
 
 #include <ctype.h>
+#include <unistd.h>
 #include <sys/uio.h>
 
+#include "statedump.h"
+
 #include "ida-common.h"
 #include "ida-mem-types.h"
 #include "ida-rabin.h"
+#include "ida-pool.h"
 #include "ida-manager.h"
 #include "ida-combine.h"
+#include "ida-coalesce.h"
+#include "ida-dirty.h"
 #include "ida.h"
 
-#define IDA_MAX_NODES 24
-#define IDA_MAX_FRAGMENTS 15
+#define IDA_MAX_NODES IDA_RABIN_MAX_ROWS
+#define IDA_MAX_FRAGMENTS IDA_RABIN_MAX_COLUMNS
 
 err_t ida_parse_size(xlator_t * this, uint32_t * nodes, uint32_t * redundancy)
 {
@@ -135,10 +141,72 @@ err_t ida_parse_options(xlator_t * this)
         RETERR()
     );
 
-    priv->node_mask = (1ULL << priv->nodes) - 1ULL;
+    // Shifting by the width of the type is undefined, so the mask of a volume
+    // with 64 nodes must be computed without it.
+    priv->node_mask = ~0ULL >> (64 - priv->nodes);
     priv->block_size = priv->fragments * IDA_GF_BITS * 16;
 
+    GF_OPTION_INIT("systematic", priv->systematic, bool, failed);
+    GF_OPTION_INIT("coding-threads", priv->coding_threads, int32, failed);
+    GF_OPTION_INIT("coding-min-size", priv->coding_min_size, size, failed);
+    GF_OPTION_INIT("stripe-cache-size", priv->stripe_cache_size, size,
+                   failed);
+    GF_OPTION_INIT("read-hedging", priv->hedging, bool, failed);
+    GF_OPTION_INIT("child-queue-depth", priv->queue_depth, int32, failed);
+    GF_OPTION_INIT("request-trace-size", priv->trace_size, int32, failed);
+    GF_OPTION_INIT("heal-chunk-size", priv->heal_chunk_size, size, failed);
+    GF_OPTION_INIT("heal-window", priv->heal_window, int32, failed);
+    GF_OPTION_INIT("heal-dirty-region-size", priv->dirty_size, size, failed);
+    GF_OPTION_INIT("heal-crawl-interval", priv->crawl_interval, int32,
+                   failed);
+    GF_OPTION_INIT("heal-crawl-heals", priv->crawl_heals, int32, failed);
+    GF_OPTION_INIT("write-coalesce-size", priv->coalesce_size, size, failed);
+    GF_OPTION_INIT("write-coalesce-timeout", priv->coalesce_timeout, int32,
+                   failed);
+
+    // Buffered writes are only sent once they fill whole blocks.
+    priv->coalesce_size -= priv->coalesce_size % priv->block_size;
+
+    // Healed chunks must contain whole blocks to avoid partial writes.
+    priv->heal_chunk_size -= priv->heal_chunk_size % priv->block_size;
+    if (priv->heal_chunk_size == 0)
+    {
+        priv->heal_chunk_size = priv->block_size;
+    }
+
+    // Modified regions are healed chunk by chunk.
+    if (priv->dirty_size > 0)
+    {
+        priv->dirty_size -= priv->dirty_size % priv->heal_chunk_size;
+        if (priv->dirty_size == 0)
+        {
+            priv->dirty_size = priv->heal_chunk_size;
+        }
+    }
+
+    if (priv->coding_threads < 0)
+    {
+        priv->coding_threads = sysconf(_SC_NPROCESSORS_ONLN);
+        if (priv->coding_threads < 1)
+        {
+            priv->coding_threads = 1;
+        }
+    }
+
+    SYS_CALL(
+        ida_rabin_setup, (&priv->rabin, priv->nodes, priv->fragments,
+                          priv->systematic),
+        E(),
+        LOG(E(), "Unable to build the dispersal matrix."),
+        RETERR()
+    );
+
     return 0;
+
+failed:
+    logE("Invalid coding options.");
+
+    return EINVAL;
 }
 
 err_t ida_prepare_childs(xlator_t * this)
@@ -180,6 +248,8 @@ err_t ida_prepare_childs(xlator_t * this)
     count = 0;
     for (child = this->children; child != NULL; child = child->next)
     {
+        LOCK_INIT(&priv->childs[count].lock);
+        INIT_LIST_HEAD(&priv->childs[count].queue);
         priv->xl_list[count++] = child->xlator;
     }
 
@@ -189,16 +259,32 @@ err_t ida_prepare_childs(xlator_t * this)
 void __ida_destroy_private(xlator_t * this)
 {
     ida_private_t * priv;
+    int32_t i;
 
     priv = this->private;
     if (priv != NULL)
     {
         if (priv->xl_list != NULL)
         {
+            for (i = 0; i < priv->nodes; i++)
+            {
+                LOCK_DESTROY(&priv->childs[i].lock);
+            }
             SYS_FREE(priv->xl_list);
             priv->xl_list = NULL;
         }
 
+        ida_crawl_terminate(&priv->crawl);
+        ida_worker_terminate(&priv->workers);
+        ida_cache_terminate(&priv->cache);
+        ida_stats_terminate(&priv->stats);
+        ida_trace_terminate(&priv->trace);
+        ida_rabin_cleanup(&priv->rabin);
+        if (priv->pooled)
+        {
+            ida_pool_terminate();
+        }
+
         sys_mutex_terminate(&priv->lock);
 
         SYS_FREE(priv);
@@ -254,6 +340,8 @@ SYS_DELAY_CREATE(ida_up, ((xlator_t *, xl)))
         priv->up = true;
         logI("Going UP");
         default_notify(xl, GF_EVENT_CHILD_UP, NULL);
+
+        ida_crawl_start(&priv->crawl);
     }
 
     sys_mutex_unlock(&priv->lock);
@@ -350,6 +438,9 @@ int32_t init(xlator_t * this)
 
     this->private = priv;
 
+    ida_rabin_initialize();
+    logD("Using %s coding backend.", ida_rabin_backend_name());
+
     SYS_CALL(
         ida_parse_options, (this),
         E(),
@@ -361,7 +452,37 @@ int32_t init(xlator_t * this)
         GOTO(failed)
     );
 
-    ida_rabin_initialize();
+    SYS_CALL(
+        ida_pool_initialize, (),
+        E(),
+        GOTO(failed)
+    );
+    priv->pooled = true;
+
+    SYS_CALL(
+        ida_worker_initialize, (&priv->workers, this, priv->coding_threads),
+        E(),
+        GOTO(failed)
+    );
+
+    SYS_CALL(
+        ida_cache_initialize, (&priv->cache, priv->block_size,
+                               priv->stripe_cache_size / priv->block_size),
+        E(),
+        GOTO(failed)
+    );
+
+    SYS_CALL(
+        ida_stats_initialize, (&priv->stats, priv->nodes),
+        E(),
+        GOTO(failed)
+    );
+
+    SYS_CALL(
+        ida_trace_initialize, (&priv->trace, priv->trace_size),
+        E(),
+        GOTO(failed)
+    );
 
     SYS_CALL(
         gfsys_initialize, (NULL, false),
@@ -375,6 +496,12 @@ int32_t init(xlator_t * this)
         GOTO(failed)
     );
 
+    SYS_CALL(
+        ida_crawl_initialize, (&priv->crawl, this),
+        E(),
+        GOTO(failed)
+    );
+
     logD("Disperse translator loaded.");
 
     return 0;
@@ -440,6 +567,16 @@ void fini(xlator_t * this)
         req->failed = 0; \
         req->completed = 0; \
         req->bad = bad; \
+        req->preferred = 0; \
+        req->cached[0].entry = NULL; \
+        req->cached[1].entry = NULL; \
+        req->barrier = NULL; \
+        req->hedge = IDA_HEDGE_NONE; \
+        req->hedge_delay = 0; \
+        req->fop = IDA_FOP_ID_##_fop; \
+        req->started = ida_time_now(); \
+        req->dirty = false; \
+        IDA_TRACE(ida, req, START, -1, 0); \
         req->xdata = &args->xdata; \
         sys_loc_acquire(&req->loc1, loc1); \
         sys_loc_acquire(&req->loc2, loc2); \
@@ -523,8 +660,17 @@ uintptr_t ida_get_inode_bad(xlator_t * xl, inode_t * inode)
 
 uintptr_t ida_get_bad(xlator_t * xl, loc_t * loc1, loc_t * loc2, fd_t * fd)
 {
+    ida_private_t * ida;
     uintptr_t bad = 0;
 
+    // Bad subvolumes are only known while some inode is being healed. When
+    // no heal is running, inode contexts don't need to be checked.
+    ida = xl->private;
+    if (__atomic_load_n(&ida->healing, __ATOMIC_ACQUIRE) == 0)
+    {
+        return 0;
+    }
+
     if ((loc1 != NULL) && (loc1->inode != NULL))
     {
         bad |= ida_get_inode_bad(xl, loc1->inode);
@@ -541,9 +687,9 @@ uintptr_t ida_get_bad(xlator_t * xl, loc_t * loc1, loc_t * loc2, fd_t * fd)
     return bad;
 }
 
-#define IDA_GF_FOP(_fop, _req, _dfc, _loc1, _loc2, _fd) \
-    int32_t ida_gf_##_fop(call_frame_t * frame, xlator_t * xl, \
-                          SYS_ARGS_DECL((SYS_GF_ARGS_##_fop))) \
+#define IDA_GF_FOP_NAMED(_name, _fop, _req, _dfc, _loc1, _loc2, _fd) \
+    int32_t _name(call_frame_t * frame, xlator_t * xl, \
+                  SYS_ARGS_DECL((SYS_GF_ARGS_##_fop))) \
     { \
         int32_t required; \
         ida_private_t * ida = xl->private; \
@@ -578,6 +724,63 @@ uintptr_t ida_get_bad(xlator_t * xl, loc_t * loc1, loc_t * loc2, fd_t * fd)
         return 0; \
     }
 
+#define IDA_GF_FOP(_fop, _req, _dfc, _loc1, _loc2, _fd) \
+    IDA_GF_FOP_NAMED(ida_gf_##_fop, _fop, _req, _dfc, _loc1, _loc2, _fd)
+
+// Defines ida_gf_<fop>() to wait until all buffered writes that the fop must
+// see have finished before calling '_resume'. '_stub' is called instead when
+// the fop has waited.
+#define IDA_GF_FOP_COALESCED(_fop, _stub, _resume, _active, _wait) \
+    int32_t ida_gf_##_fop(call_frame_t * frame, xlator_t * xl, \
+                          SYS_ARGS_DECL((SYS_GF_ARGS_##_fop))) \
+    { \
+        call_stub_t * stub; \
+        if (_active) \
+        { \
+            stub = fop_##_fop##_stub(frame, _stub, \
+                                     SYS_ARGS_NAMES((SYS_GF_ARGS_##_fop))); \
+            if (_wait) \
+            { \
+                return 0; \
+            } \
+            if (stub != NULL) \
+            { \
+                call_stub_destroy(stub); \
+            } \
+        } \
+        return _resume(frame, xl, SYS_ARGS_NAMES((SYS_GF_ARGS_##_fop))); \
+    }
+
+#define IDA_GF_FOP_COALESCED_FD(_fop, _resume) \
+    IDA_GF_FOP_COALESCED(_fop, _resume, _resume, \
+                         ida_coalesce_get(xl, fd) != NULL, \
+                         ida_coalesce_wait(xl, fd, stub))
+
+// Fops received by path wait for the buffered writes of all fds of the
+// inode. They are resumed into the same function to check the fds again.
+#define IDA_GF_FOP_COALESCED_LOC(_fop) \
+    IDA_GF_FOP_COALESCED(_fop, ida_gf_##_fop, __ida_gf_##_fop, \
+                         ida_coalesce_inode_active(xl, loc->inode), \
+                         ida_coalesce_wait_inode(xl, loc->inode, stub))
+
+// Flushes and fsyncs also report the first error of the buffered writes.
+#define IDA_GF_FOP_COALESCED_ERROR(_fop, ...) \
+    static int32_t ida_gf_##_fop##_resume(call_frame_t * frame, \
+                                          xlator_t * xl, \
+                                          SYS_ARGS_DECL((SYS_GF_ARGS_##_fop))) \
+    { \
+        int32_t error; \
+        error = ida_coalesce_error(xl, fd); \
+        if (error != 0) \
+        { \
+            STACK_UNWIND_STRICT(_fop, frame, -1, error, __VA_ARGS__); \
+            return 0; \
+        } \
+        return __ida_gf_##_fop(frame, xl, \
+                               SYS_ARGS_NAMES((SYS_GF_ARGS_##_fop))); \
+    } \
+    IDA_GF_FOP_COALESCED_FD(_fop, ida_gf_##_fop##_resume)
+
 
 // Some fops need to wait for *all* answers because further operations could
 // fail in server xlator. For example, a create request could be answered as
@@ -591,8 +794,6 @@ IDA_GF_FOP(access,       ONE, DIO, loc,    NULL,   NULL)
 IDA_GF_FOP(create,       ALL, DFC, loc,    NULL,   fd)
 IDA_GF_FOP(entrylk,      MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(fentrylk,     MIN, DFC, NULL,   NULL,   fd)
-IDA_GF_FOP(flush,        MIN, DIO, NULL,   NULL,   fd)
-IDA_GF_FOP(fsync,        MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(fsyncdir,     MIN, DIO, NULL,   NULL,   fd)
 IDA_GF_FOP(getxattr,     ONE, DIO, loc,    NULL,   NULL)
 IDA_GF_FOP(fgetxattr,    ONE, DIO, NULL,   NULL,   fd)
@@ -603,13 +804,11 @@ IDA_GF_FOP(lk,           MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(lookup,       MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(mkdir,        ALL, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(mknod,        ALL, DFC, loc,    NULL,   NULL)
-IDA_GF_FOP(open,         ALL, DFC, loc,    NULL,   fd)
 IDA_GF_FOP(opendir,      ALL, DFC, loc,    NULL,   fd)
 IDA_GF_FOP(rchecksum,    MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(readdir,      ONE, DIO, NULL,   NULL,   fd)
 IDA_GF_FOP(readdirp,     ONE, DIO, NULL,   NULL,   fd)
 IDA_GF_FOP(readlink,     ONE, DIO, loc,    NULL,   NULL)
-IDA_GF_FOP(readv,        MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(removexattr,  MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(fremovexattr, MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(rename,       ALL, DFC, oldloc, newloc, NULL)
@@ -618,22 +817,85 @@ IDA_GF_FOP(setattr,      MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(fsetattr,     MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(setxattr,     MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(fsetxattr,    MIN, DFC, NULL,   NULL,   fd)
-IDA_GF_FOP(stat,         ONE, DIO, loc,    NULL,   NULL)
-IDA_GF_FOP(fstat,        ONE, DIO, NULL,   NULL,   fd)
 IDA_GF_FOP(statfs,       ALL, DIO, loc,    NULL,   NULL)
 IDA_GF_FOP(symlink,      MIN, DFC, loc,    NULL,   NULL)
-IDA_GF_FOP(truncate,     MIN, DFC, loc,    NULL,   NULL)
-IDA_GF_FOP(ftruncate,    MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(unlink,       MIN, DFC, loc,    NULL,   NULL)
-IDA_GF_FOP(writev,       MIN, DFC, NULL,   NULL,   fd)
 IDA_GF_FOP(xattrop,      MIN, DFC, loc,    NULL,   NULL)
 IDA_GF_FOP(fxattrop,     MIN, DFC, NULL,   NULL,   fd)
 
+// Fops that need to take into account the buffered writes of an fd are
+// implemented by the functions below, that call these ones.
+IDA_GF_FOP_NAMED(__ida_gf_flush,     flush,     MIN, DIO, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_fsync,     fsync,     MIN, DFC, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_readv,     readv,     MIN, DFC, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_fstat,     fstat,     ONE, DIO, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_ftruncate, ftruncate, MIN, DFC, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_writev,    writev,    MIN, DFC, NULL, NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_open,      open,      ALL, DFC, loc,  NULL, fd)
+IDA_GF_FOP_NAMED(__ida_gf_stat,      stat,      ONE, DIO, loc,  NULL, NULL)
+IDA_GF_FOP_NAMED(__ida_gf_truncate,  truncate,  MIN, DFC, loc,  NULL, NULL)
+
+int32_t ida_gf_writev(call_frame_t * frame, xlator_t * xl, fd_t * fd,
+                      struct iovec * vector, int32_t count, off_t offset,
+                      uint32_t flags, struct iobref * iobref, dict_t * xdata)
+{
+    struct iatt iatt;
+    int32_t ret;
+
+    ret = ida_coalesce_writev(xl, fd, frame, vector, count, offset, flags,
+                              xdata);
+    if (ret > 0)
+    {
+        // The attributes of the file are unknown until the data is sent.
+        // Only its identity is returned. Null times tell the upper
+        // translators that the attributes must not be cached.
+        memset(&iatt, 0, sizeof(iatt));
+        uuid_copy(iatt.ia_gfid, fd->inode->gfid);
+        iatt.ia_ino = gfid_to_ino(fd->inode->gfid);
+        iatt.ia_type = fd->inode->ia_type;
+
+        STACK_UNWIND_STRICT(writev, frame, ret, 0, &iatt, &iatt, NULL);
+
+        return 0;
+    }
+    if (ret < 0)
+    {
+        STACK_UNWIND_STRICT(writev, frame, -1, -ret, NULL, NULL, NULL);
+
+        return 0;
+    }
+
+    return __ida_gf_writev(frame, xl, fd, vector, count, offset, flags,
+                           iobref, xdata);
+}
+
+IDA_GF_FOP_COALESCED_ERROR(flush, NULL)
+IDA_GF_FOP_COALESCED_ERROR(fsync, NULL, NULL, NULL)
+
+// Reads, fstats and ftruncates wait until all buffered writes of the fd have
+// finished, so that they see the data already acknowledged to the
+// application. Errors of buffered writes are left to be reported by a later
+// writev, flush or fsync.
+IDA_GF_FOP_COALESCED_FD(readv, __ida_gf_readv)
+IDA_GF_FOP_COALESCED_FD(fstat, __ida_gf_fstat)
+IDA_GF_FOP_COALESCED_FD(ftruncate, __ida_gf_ftruncate)
+
+// The same applies to the buffered writes of any fd of the inode when it's
+// accessed by path.
+IDA_GF_FOP_COALESCED_LOC(open)
+IDA_GF_FOP_COALESCED_LOC(stat)
+IDA_GF_FOP_COALESCED_LOC(truncate)
+
 int32_t ida_gf_forget(xlator_t * this, inode_t * inode)
 {
+    ida_private_t * ida;
     uint64_t value;
     ida_inode_ctx_t * ctx;
 
+    ida = this->private;
+    ida_cache_invalidate(&ida->cache, inode->gfid);
+    ida_dirty_forget(this, inode);
+
     if ((inode_ctx_del(inode, this, &value) == 0) && (value != 0))
     {
         ctx = (ida_inode_ctx_t *)value;
@@ -656,6 +918,7 @@ int32_t ida_gf_release(xlator_t * this, fd_t * fd)
     if ((fd_ctx_del(fd, this, &value) == 0) && (value != 0))
     {
         ctx = (ida_fd_ctx_t *)(uintptr_t)value;
+        ida_coalesce_terminate(&ctx->coalesce);
         loc_wipe(&ctx->loc);
         SYS_FREE(ctx);
     }
@@ -671,6 +934,7 @@ int32_t ida_gf_releasedir(xlator_t * this, fd_t * fd)
     if ((fd_ctx_del(fd, this, &value) == 0) && (value != 0))
     {
         ctx = (ida_fd_ctx_t *)(uintptr_t)value;
+        ida_coalesce_terminate(&ctx->coalesce);
         loc_wipe(&ctx->loc);
         SYS_FREE(ctx);
     }
@@ -678,6 +942,56 @@ int32_t ida_gf_releasedir(xlator_t * this, fd_t * fd)
     return 0;
 }
 
+int32_t ida_dump_priv(xlator_t * this)
+{
+    ida_private_t * priv;
+    ida_child_t * child;
+    char key_prefix[GF_DUMP_MAX_BUF_LEN];
+    char key[GF_DUMP_MAX_BUF_LEN];
+    int32_t i;
+
+    priv = this->private;
+    if (priv == NULL)
+    {
+        return 0;
+    }
+
+    gf_proc_dump_build_key(key_prefix, this->type, "%s", this->name);
+    gf_proc_dump_add_section(key_prefix);
+
+    gf_proc_dump_write("up", "%d", priv->up);
+    gf_proc_dump_write("child_queue_depth", "%d", priv->queue_depth);
+    gf_proc_dump_write("healing", "%d", priv->healing);
+
+    for (i = 0; i < priv->nodes; i++)
+    {
+        child = &priv->childs[i];
+
+        snprintf(key, sizeof(key), "child[%d].name", i);
+        gf_proc_dump_write(key, "%s", priv->xl_list[i]->name);
+        snprintf(key, sizeof(key), "child[%d].inflight", i);
+        gf_proc_dump_write(key, "%d", child->inflight);
+        snprintf(key, sizeof(key), "child[%d].queued", i);
+        gf_proc_dump_write(key, "%d", child->queued);
+        snprintf(key, sizeof(key), "child[%d].parked", i);
+        gf_proc_dump_write(key, "%" PRIu64, child->parked);
+        snprintf(key, sizeof(key), "child[%d].latency", i);
+        gf_proc_dump_write(key, "%" PRIu64,
+                           child->latency >> IDA_LATENCY_SHIFT);
+    }
+
+    ida_stats_dump(&priv->stats, this);
+    ida_trace_dump(&priv->trace, this);
+    ida_crawl_dump(&priv->crawl);
+
+    return 0;
+}
+
+struct xlator_dumpops dumpops =
+{
+    .priv = ida_dump_priv
+};
+
 SYS_GF_FOP_TABLE(ida_gf);
 SYS_GF_CBK_TABLE(ida_gf);
 
@@ -705,5 +1019,146 @@ struct volume_options options[] =
         .type = GF_OPTION_TYPE_INT,
         .description = "File system block size"
     },
+    {
+        .key = { "systematic" },
+        .type = GF_OPTION_TYPE_BOOL,
+        .default_value = "off",
+        .description = "Store the original data unmodified on the first "
+                       "fragments so that reads can be served without "
+                       "decoding while all of them are healthy. This changes "
+                       "the on-disk format, so it can only be set when the "
+                       "volume is created."
+    },
+    {
+        .key = { "coding-threads" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = -1,
+        .max = 256,
+        .default_value = "-1",
+        .description = "Number of threads used to encode and decode big "
+                       "requests in parallel. -1 means one thread for each "
+                       "available CPU. 0 means that coding is always done by "
+                       "the thread that processes the request."
+    },
+    {
+        .key = { "coding-min-size" },
+        .type = GF_OPTION_TYPE_SIZET,
+        .default_value = "1MB",
+        .description = "Minimum size of a request to be encoded or decoded "
+                       "using the coding threads. Smaller requests are coded "
+                       "by the thread that processes them."
+    },
+    {
+        .key = { "stripe-cache-size" },
+        .type = GF_OPTION_TYPE_SIZET,
+        .default_value = "0",
+        .description = "Amount of memory used to keep the contents of the "
+                       "partially written blocks of recent writes, so that "
+                       "adjacent unaligned writes do not need to read them "
+                       "from the bricks. 0 disables the cache. It must only "
+                       "be enabled if each file is written from a single "
+                       "client at a time."
+    },
+    {
+        .key = { "read-hedging" },
+        .type = GF_OPTION_TYPE_BOOL,
+        .default_value = "off",
+        .description = "Reserve an additional subvolume for each read and "
+                       "send the read to it if the answers of the other "
+                       "subvolumes take longer than usual. The first answers "
+                       "that are enough to rebuild the data are used."
+    },
+    {
+        .key = { "child-queue-depth" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 0,
+        .max = 65536,
+        .default_value = "0",
+        .description = "Maximum number of requests sent to each subvolume "
+                       "that can be pending at the same time. Additional "
+                       "requests wait until some of the previous ones are "
+                       "answered, and reads are sent to other subvolumes if "
+                       "possible. 0 means no limit."
+    },
+    {
+        .key = { "write-coalesce-size" },
+        .type = GF_OPTION_TYPE_SIZET,
+        .default_value = "0",
+        .description = "Maximum amount of data of sequential writes on the "
+                       "same fd that are kept in memory to be sent as a "
+                       "single write. It's rounded down to a multiple of the "
+                       "block size. Buffered data is not visible through "
+                       "other fds until it's sent, so it must only be "
+                       "enabled when each file is written through a single "
+                       "fd at a time. 0 disables write coalescing."
+    },
+    {
+        .key = { "write-coalesce-timeout" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 1,
+        .max = 60000,
+        .default_value = "100",
+        .description = "Maximum time, in milliseconds, that coalesced writes "
+                       "are kept in memory before being sent to the bricks."
+    },
+    {
+        .key = { "request-trace-size" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 0,
+        .max = 1048576,
+        .default_value = "0",
+        .description = "Number of request lifecycle events kept in memory "
+                       "for each group of threads, rounded up to a power of "
+                       "two. They are shown in the statedump. 0 disables "
+                       "tracing."
+    },
+    {
+        .key = { "heal-chunk-size" },
+        .type = GF_OPTION_TYPE_SIZET,
+        .default_value = "128KB",
+        .description = "Amount of data read and written at once while the "
+                       "data of a file is being healed. It's rounded down to "
+                       "a multiple of the block size."
+    },
+    {
+        .key = { "heal-window" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 1,
+        .max = 64,
+        .default_value = "1",
+        .description = "Number of chunks of each file that can be read or "
+                       "written at the same time while its data is being "
+                       "healed."
+    },
+    {
+        .key = { "heal-dirty-region-size" },
+        .type = GF_OPTION_TYPE_SIZET,
+        .default_value = "0",
+        .description = "Size of the regions of a file whose modifications "
+                       "are recorded until all bricks have succeeded, so "
+                       "that only the modified regions are healed. It's rounded down "
+                       "to a multiple of the heal chunk size. It must be the "
+                       "same on all clients. 0 disables the recording and "
+                       "files are always healed completely."
+    },
+    {
+        .key = { "heal-crawl-interval" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 0,
+        .default_value = "0",
+        .description = "Number of seconds between two consecutive crawls of "
+                       "the volume looking for entries that need to be "
+                       "healed. An interrupted crawl is resumed from its "
+                       "last stored position. It should only be enabled on "
+                       "one client. 0 disables the crawl."
+    },
+    {
+        .key = { "heal-crawl-heals" },
+        .type = GF_OPTION_TYPE_INT,
+        .min = 1,
+        .default_value = "4",
+        .description = "Maximum number of heals in progress that allow the "
+                       "crawl to check more entries."
+    },
     { }
 };
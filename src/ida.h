@@ -27,6 +27,8 @@
 
 #define IDA_KEY_VERSION "trusted.ida.version"
 #define IDA_KEY_SIZE "trusted.ida.size"
+#define IDA_KEY_DIRTY "trusted.ida.dirty"
+#define IDA_KEY_CRAWL "trusted.ida.crawl"
 
 #define HEAL_KEY_FLAGS "trusted.heal.flags"
 #define HEAL_KEY_SIZE "trusted.heal.size"